@@ -22,6 +22,7 @@
 #include <string.h>
 #include <argtable2.h>
 #include <inttypes.h>
+#include "../library/lib/atom.h"
 #include "../library/lib/error.h"
 #include "../library/lib/scanner.h"
 #include "../library/lib/parser.h"
@@ -29,6 +30,7 @@
 #include "../library/lib/environment.h"
 #include "../library/lib/object.h"
 #include "../library/lib/binding.h"
+#include "../library/lib/bytecode/chunk.h"
 
 /**
  * @brief Helper to read file content
@@ -78,7 +80,7 @@ static char* read_file( const char* path ) {
  */
 static bosl_object_t* c_foo(
   __unused bosl_object_t* o,
-  list_manager_t* parameter
+  vector_t* parameter
 ) {
   // get parameter
   bosl_object_t* parameter_object = bosl_object_extract_parameter( parameter, 0 );
@@ -105,7 +107,7 @@ static bosl_object_t* c_foo(
  */
 static bosl_object_t* c_foo_2(
   __unused bosl_object_t* o,
-  __unused list_manager_t* parameter
+  __unused vector_t* parameter
 ) {
   // do something
   printf( "c_foo_2!\r\n" );
@@ -123,7 +125,7 @@ static bosl_object_t* c_foo_2(
  */
 static bosl_object_t* c_foo_3(
   __unused bosl_object_t* o,
-  __unused list_manager_t* parameter
+  __unused vector_t* parameter
 ) {
   bosl_interpreter_emit_error( NULL, "c_foo_3 error!" );
   return NULL;
@@ -133,10 +135,17 @@ static bosl_object_t* c_foo_3(
  * @brief Interpret buffer
  *
  * @param print_ast print ast instead of interpreting
+ * @param print_bytecode print bytecode instead of interpreting
+ * @param engine engine used for interpreting
  * @param buffer code to interpret
  * @return
  */
-static bool interpret( bool print_ast, char* buffer ) {
+static bool interpret(
+  bool print_ast,
+  bool print_bytecode,
+  bosl_interpreter_engine_t engine,
+  char* buffer
+) {
   // initialize object handling
   if ( !bosl_object_init() ) {
     fprintf( stderr, "Unable to init object!\r\n" );
@@ -148,21 +157,14 @@ static bool interpret( bool print_ast, char* buffer ) {
     fprintf( stderr, "Unable to init scanner!\r\n" );
     return false;
   }
-  // scan token
-  list_manager_t* token_list = bosl_scanner_scan();
-  if ( !token_list ) {
-    bosl_object_free();
-    bosl_scanner_free();
-    return false;
-  }
-  // init parser
-  if ( !bosl_parser_init( token_list ) ) {
+  // init parser pulling token from scanner
+  if ( !bosl_parser_init() ) {
     bosl_object_free();
     bosl_scanner_free();
     return false;
   }
   // parse ast
-  list_manager_t* ast_list = bosl_parser_scan();
+  vector_t* ast_list = bosl_parser_scan();
   if ( !ast_list ) {
     bosl_object_free();
     bosl_parser_free();
@@ -197,8 +199,10 @@ static bool interpret( bool print_ast, char* buffer ) {
     bosl_scanner_free();
     return false;
   }
-  // setup interpreter
-  if ( !bosl_interpreter_init( ast_list ) ) {
+  // setup interpreter, bytecode is compiled there for disassembly as well
+  if ( !bosl_interpreter_init(
+    ast_list, print_bytecode ? BOSL_INTERPRETER_ENGINE_BYTECODE : engine
+  ) ) {
     bosl_binding_free();
     bosl_object_free();
     bosl_parser_free();
@@ -209,6 +213,9 @@ static bool interpret( bool print_ast, char* buffer ) {
   if ( print_ast ) {
     // print ast
     bosl_parser_print();
+  } else if ( print_bytecode ) {
+    // print bytecode compiled by interpreter
+    bosl_chunk_print( bosl_interpreter_chunk() );
   } else {
     // run code
     if ( !bosl_interpreter_run() ) {
@@ -236,9 +243,12 @@ int main( int argc, char* argv[] ) {
   struct arg_lit* help = arg_lit0( "h", "help", "print help" );
   struct arg_lit* version = arg_lit0( NULL, "version", "print version" );
   struct arg_lit* ast = arg_lit0( "a", "ast", "print ast" );
+  struct arg_lit* bytecode = arg_lit0( "b", "bytecode", "execute with bytecode vm" );
+  struct arg_lit* disassemble = arg_lit0( "d", "disassemble", "print bytecode" );
   struct arg_file* infile = arg_filen( NULL, NULL, NULL, 1, 1, "input file" );
   struct arg_end* end = arg_end( 20 );
-  void* argument_table[] = { verbose, help, version, ast, infile, end, };
+  void* argument_table[] = {
+    verbose, help, version, ast, bytecode, disassemble, infile, end, };
   int error_count;
 
   // verify argument_table entries have been allocated
@@ -291,14 +301,18 @@ int main( int argc, char* argv[] ) {
     return EXIT_FAILURE;
   }
   // interpret it
-  if ( !interpret( ast->count, buffer ) ) {
-    // free buffer and free argument_table
-    free( buffer );
-    arg_freetable( argument_table, sizeof( argument_table ) / sizeof( argument_table[ 0 ] ) );
-    return EXIT_FAILURE;
-  }
+  bool result = interpret(
+    ast->count,
+    disassemble->count,
+    bytecode->count
+      ? BOSL_INTERPRETER_ENGINE_BYTECODE
+      : BOSL_INTERPRETER_ENGINE_AST,
+    buffer
+  );
+  // free interned names
+  bosl_atom_free();
   // free buffer and free argument_table
   free( buffer );
   arg_freetable( argument_table, sizeof( argument_table ) / sizeof( argument_table[ 0 ] ) );
-  return EXIT_SUCCESS;
+  return result ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -22,15 +22,17 @@
 #include "common.h"
 #include "expression.h"
 #include "statement.h"
+#include "../collection/arena.h"
 
 /**
  * @brief Helper to allocate a ast node
  *
+ * @param arena
  * @return
  */
-bosl_ast_node_t* bosl_ast_node_allocate( void ) {
+bosl_ast_node_t* bosl_ast_node_allocate( arena_t* arena ) {
   // allocate new ast node
-  bosl_ast_node_t* node = malloc( sizeof( bosl_ast_node_t ) );
+  bosl_ast_node_t* node = arena_allocate( arena, sizeof( bosl_ast_node_t ) );
   if ( !node ) {
     return NULL;
   }
@@ -39,16 +41,3 @@ bosl_ast_node_t* bosl_ast_node_allocate( void ) {
   // return data
   return node;
 }
-
-/**
- * @brief Helper to destroy a node
- *
- * @param node
- */
-void bosl_ast_node_destroy( bosl_ast_node_t* node ) {
-  if ( !node ) {
-    return;
-  }
-  bosl_ast_statement_destroy( node->statement );
-  free( node );
-}
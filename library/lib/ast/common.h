@@ -18,9 +18,11 @@
  */
 
 #if defined( _COMPILING_BOSL )
+  #include "../collection/arena.h"
   #include "statement.h"
   #include "expression.h"
 #else
+  #include <bosl/collection/arena.h>
   #include <bosl/ast/statement.h>
   #include <bosl/ast/expression.h>
 #endif
@@ -36,8 +38,7 @@ typedef struct {
   bosl_ast_statement_t* statement;
 } bosl_ast_node_t;
 
-bosl_ast_node_t* bosl_ast_node_allocate( void );
-void bosl_ast_node_destroy( bosl_ast_node_t* );
+bosl_ast_node_t* bosl_ast_node_allocate( arena_t* );
 
 #ifdef __cplusplus
 }
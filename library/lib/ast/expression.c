@@ -20,23 +20,22 @@
 #include <stdlib.h>
 #include <string.h>
 #include "expression.h"
+#include "../collection/arena.h"
 
 /**
  * @brief Method to allocate ast expression
  *
+ * @param arena
  * @param type
  * @return
+ *
+ * @note inner data is placed directly behind the expression within the arena
  */
-bosl_ast_expression_t* bosl_ast_expression_allocate( bosl_ast_expression_type_t type ) {
+bosl_ast_expression_t* bosl_ast_expression_allocate(
+  arena_t* arena,
+  bosl_ast_expression_type_t type
+) {
   size_t allocated_size;
-  void* inner_block = NULL;
-  // allocate container
-  bosl_ast_expression_t* expression = malloc( sizeof( bosl_ast_expression_t ) );
-  if ( !expression ) {
-    return NULL;
-  }
-  // clear out
-  memset( expression, 0, sizeof( bosl_ast_expression_t ) );
   // determine space for inner
   switch ( type ) {
     case EXPRESSION_ASSIGN:
@@ -74,20 +73,19 @@ bosl_ast_expression_t* bosl_ast_expression_allocate( bosl_ast_expression_type_t
   }
   // handle error
   if ( !allocated_size ) {
-    free( expression );
     return NULL;
   }
-  // allocate inner structure
-  inner_block = malloc( allocated_size );
-  if ( !inner_block ) {
-    free( expression );
+  // allocate container together with inner structure
+  bosl_ast_expression_t* expression = arena_allocate(
+    arena, sizeof( bosl_ast_expression_t ) + allocated_size );
+  if ( !expression ) {
     return NULL;
   }
-  memset( inner_block, 0, allocated_size );
+  // clear out
+  memset( expression, 0, sizeof( bosl_ast_expression_t ) + allocated_size );
   // set expression content finally
   expression->type = type;
-  expression->data = inner_block;
-  expression->size = allocated_size;
+  expression->data = expression + 1;
   // return built expression
   return expression;
 }
@@ -95,16 +93,19 @@ bosl_ast_expression_t* bosl_ast_expression_allocate( bosl_ast_expression_type_t
 /**
  * @brief Helper to allocate and populate binary expression
  *
+ * @param arena
  * @param left
  * @param right
  * @return
  */
 bosl_ast_expression_t* bosl_ast_expression_allocate_binary(
+  arena_t* arena,
   bosl_ast_expression_t* left,
   bosl_token_t* operator,
   bosl_ast_expression_t* right
 ) {
-  bosl_ast_expression_t* e = bosl_ast_expression_allocate( EXPRESSION_BINARY );
+  bosl_ast_expression_t* e = bosl_ast_expression_allocate(
+    arena, EXPRESSION_BINARY );
   if ( !e ) {
     return NULL;
   }
@@ -121,16 +122,19 @@ bosl_ast_expression_t* bosl_ast_expression_allocate_binary(
 /**
  * @brief Helper to allocate and populate logical expression
  *
+ * @param arena
  * @param left
  * @param right
  * @return
  */
 bosl_ast_expression_t* bosl_ast_expression_allocate_logical(
+  arena_t* arena,
   bosl_ast_expression_t* left,
   bosl_token_t* operator,
   bosl_ast_expression_t* right
 ) {
-  bosl_ast_expression_t* e = bosl_ast_expression_allocate( EXPRESSION_LOGICAL );
+  bosl_ast_expression_t* e = bosl_ast_expression_allocate(
+    arena, EXPRESSION_LOGICAL );
   if ( !e ) {
     return NULL;
   }
@@ -147,27 +151,29 @@ bosl_ast_expression_t* bosl_ast_expression_allocate_logical(
 /**
  * @brief Helper to allocate and populate literal expression
  *
+ * @param arena
  * @param data
  * @param size
  * @return
  */
 bosl_ast_expression_t* bosl_ast_expression_allocate_literal(
+  arena_t* arena,
   const void* data,
   size_t size,
   bosl_ast_expression_literal_type_t type
 ) {
   // allocate expression
-  bosl_ast_expression_t* e = bosl_ast_expression_allocate( EXPRESSION_LITERAL );
+  bosl_ast_expression_t* e = bosl_ast_expression_allocate(
+    arena, EXPRESSION_LITERAL );
   if ( !e ) {
     return NULL;
   }
   // get inner type
   bosl_ast_expression_literal_t* literal = e->data;
-  // allocate space for literal
-  if ( data ) {
-    literal->value = malloc( size );
+  // allocate space for literal, empty data needs no space
+  if ( data && size ) {
+    literal->value = arena_allocate( arena, size );
     if ( !literal->value ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     // copy over data
@@ -182,53 +188,3 @@ bosl_ast_expression_t* bosl_ast_expression_allocate_literal(
   // return success
   return e;
 }
-
-/**
- * @brief Helper to destroy ast expression
- *
- * @param expression
- */
-void bosl_ast_expression_destroy( bosl_ast_expression_t* expression ) {
-  if ( !expression ) {
-    return;
-  }
-  if ( expression->data ) {
-    switch ( expression->type ) {
-      case EXPRESSION_ASSIGN:
-        bosl_ast_expression_destroy( expression->assign->value );
-        break;
-      case EXPRESSION_BINARY:
-        bosl_ast_expression_destroy( expression->binary->left );
-        bosl_ast_expression_destroy( expression->binary->right );
-        break;
-      case EXPRESSION_CALL:
-        list_destruct( expression->call->arguments );
-        bosl_ast_expression_destroy( expression->call->callee );
-        break;
-      case EXPRESSION_LOAD:
-      case EXPRESSION_POINTER:
-        // contains only token reference
-        break;
-      case EXPRESSION_GROUPING:
-        bosl_ast_expression_destroy( expression->grouping->expression );
-        break;
-      case EXPRESSION_LITERAL:
-        free( expression->literal->value );
-        break;
-      case EXPRESSION_LOGICAL:
-        bosl_ast_expression_destroy( expression->logical->left );
-        bosl_ast_expression_destroy( expression->logical->right );
-        break;
-      case EXPRESSION_UNARY:
-        bosl_ast_expression_destroy( expression->unary->right );
-        break;
-      case EXPRESSION_VARIABLE:
-        // contains only token reference
-        break;
-    }
-    // free data
-    free( expression->data );
-  }
-  // free expression itself
-  free( expression );
-}
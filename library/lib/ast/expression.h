@@ -19,10 +19,12 @@
 
 #if defined( _COMPILING_BOSL )
   #include "../scanner.h"
-  #include "../collection/list.h"
+  #include "../collection/arena.h"
+  #include "../collection/vector.h"
 #else
   #include <bosl/scanner.h>
-  #include <bosl/collection/list.h>
+  #include <bosl/collection/arena.h>
+  #include <bosl/collection/vector.h>
 #endif
 
 #if !defined( BOSL_AST_EXPRESSION_H )
@@ -58,6 +60,8 @@ typedef struct bosl_ast_expression bosl_ast_expression_t;
 typedef struct {
   bosl_token_t* token;
   bosl_ast_expression_t* value;
+  size_t depth;
+  size_t slot;
 } bosl_ast_expression_assign_t;
 
 typedef struct {
@@ -69,7 +73,7 @@ typedef struct {
 typedef struct {
   bosl_ast_expression_t* callee;
   bosl_token_t* paren;
-  list_manager_t* arguments; // list of bosl_ast_expression_t
+  vector_t* arguments; // list of bosl_ast_expression_t
 } bosl_ast_expression_call_t;
 
 typedef struct {
@@ -95,6 +99,8 @@ typedef struct {
 
 typedef struct {
   bosl_token_t* name;
+  size_t depth;
+  size_t slot;
 } bosl_ast_expression_variable_t;
 
 typedef struct {
@@ -105,6 +111,7 @@ typedef struct {
   bosl_token_t* name;
 } bosl_ast_expression_pointer_t;
 
+// inner data follows the expression within the same arena allocation
 typedef struct bosl_ast_expression {
   bosl_ast_expression_type_t type;
   union {
@@ -120,17 +127,16 @@ typedef struct bosl_ast_expression {
     bosl_ast_expression_load_t* load;
     bosl_ast_expression_pointer_t* pointer;
   };
-  size_t size;
 } bosl_ast_expression_t;
 
-bosl_ast_expression_t* bosl_ast_expression_allocate( bosl_ast_expression_type_t );
-void bosl_ast_expression_destroy( bosl_ast_expression_t* );
+bosl_ast_expression_t* bosl_ast_expression_allocate(
+  arena_t*, bosl_ast_expression_type_t );
 bosl_ast_expression_t* bosl_ast_expression_allocate_binary(
-  bosl_ast_expression_t*, bosl_token_t*, bosl_ast_expression_t* );
+  arena_t*, bosl_ast_expression_t*, bosl_token_t*, bosl_ast_expression_t* );
 bosl_ast_expression_t* bosl_ast_expression_allocate_logical(
-  bosl_ast_expression_t*, bosl_token_t*, bosl_ast_expression_t* );
+  arena_t*, bosl_ast_expression_t*, bosl_token_t*, bosl_ast_expression_t* );
 bosl_ast_expression_t* bosl_ast_expression_allocate_literal(
-  const void*, size_t, bosl_ast_expression_literal_type_t );
+  arena_t*, const void*, size_t, bosl_ast_expression_literal_type_t );
 
 #ifdef __cplusplus
 }
@@ -20,23 +20,22 @@
 #include <stdlib.h>
 #include <string.h>
 #include "statement.h"
+#include "../collection/arena.h"
 
 /**
  * @brief Method to allocate ast statement
  *
+ * @param arena
  * @param type
  * @return
+ *
+ * @note inner data is placed directly behind the statement within the arena
  */
-bosl_ast_statement_t* bosl_ast_statement_allocate( bosl_ast_statement_type_t type ) {
+bosl_ast_statement_t* bosl_ast_statement_allocate(
+  arena_t* arena,
+  bosl_ast_statement_type_t type
+) {
   size_t allocated_size;
-  void* inner_block = NULL;
-  // allocate container
-  bosl_ast_statement_t* statement = malloc( sizeof( bosl_ast_statement_t ) );
-  if ( !statement ) {
-    return NULL;
-  }
-  // clear out
-  memset( statement, 0, sizeof( bosl_ast_statement_t ) );
   // determine space for inner
   switch ( type ) {
     case STATEMENT_BLOCK:
@@ -83,78 +82,17 @@ bosl_ast_statement_t* bosl_ast_statement_allocate( bosl_ast_statement_type_t typ
   if ( !allocated_size ) {
     return NULL;
   }
-  // allocate inner structure
-  inner_block = malloc( allocated_size );
-  if ( !inner_block ) {
-    free( statement );
+  // allocate container together with inner structure
+  bosl_ast_statement_t* statement = arena_allocate(
+    arena, sizeof( bosl_ast_statement_t ) + allocated_size );
+  if ( !statement ) {
     return NULL;
   }
-  memset( inner_block, 0, allocated_size );
+  // clear out
+  memset( statement, 0, sizeof( bosl_ast_statement_t ) + allocated_size );
   // set statement content finally
   statement->type = type;
-  statement->data = inner_block;
-  statement->size = allocated_size;
+  statement->data = statement + 1;
   // return built statement
   return statement;
 }
-
-/**
- * @brief Helper to destroy a statement
- *
- * @param statement
- */
-void bosl_ast_statement_destroy( bosl_ast_statement_t* statement ) {
-  if ( !statement ) {
-    return;
-  }
-  if ( statement->data ) {
-    switch ( statement->type ) {
-      case STATEMENT_BLOCK:
-        list_destruct( statement->block->statements );
-        break;
-      case STATEMENT_EXPRESSION:
-        bosl_ast_expression_destroy( statement->expression->expression );
-        break;
-      case STATEMENT_PARAMETER:
-        // do nothing as only token references are in here
-        break;
-      case STATEMENT_FUNCTION: {
-        list_destruct( statement->function->parameter );
-        bosl_ast_statement_destroy( statement->function->body );
-        break;
-      }
-      case STATEMENT_IF:
-        bosl_ast_expression_destroy( statement->if_else->if_condition );
-        bosl_ast_statement_destroy( statement->if_else->if_statement );
-        bosl_ast_statement_destroy( statement->if_else->else_statement );
-        break;
-      case STATEMENT_PRINT:
-        bosl_ast_expression_destroy( statement->print->expression );
-        break;
-      case STATEMENT_RETURN:
-        bosl_ast_expression_destroy( statement->return_value->value );
-        break;
-      case STATEMENT_VARIABLE:
-        bosl_ast_expression_destroy( statement->variable->initializer );
-        break;
-      case STATEMENT_CONST:
-        bosl_ast_expression_destroy( statement->constant->initializer );
-        break;
-      case STATEMENT_WHILE:
-        bosl_ast_expression_destroy( statement->while_loop->condition );
-        bosl_ast_statement_destroy( statement->while_loop->body );
-        break;
-      case STATEMENT_CONTINUE:
-      case STATEMENT_BREAK:
-        bosl_ast_expression_destroy( statement->break_continue->level );
-        break;
-      case STATEMENT_POINTER:
-        bosl_ast_statement_destroy( statement->pointer->statement );
-        break;
-    }
-    // finally free data
-    free( statement->data );
-  }
-  // free statement
-  free( statement );
-}
@@ -19,11 +19,13 @@
 
 #if defined( _COMPILING_BOSL )
   #include "../scanner.h"
-  #include "../collection/list.h"
+  #include "../collection/arena.h"
+  #include "../collection/vector.h"
   #include "expression.h"
 #else
   #include <bosl/scanner.h>
-  #include <bosl/collection/list.h>
+  #include <bosl/collection/arena.h>
+  #include <bosl/collection/vector.h>
   #include <bosl/ast/expression.h>
 #endif
 
@@ -53,7 +55,8 @@ typedef enum {
 typedef struct bosl_ast_statement bosl_ast_statement_t;
 
 typedef struct {
-  list_manager_t* statements;
+  vector_t* statements;
+  size_t slot_count;
 } bosl_ast_statement_block_t;
 
 typedef struct {
@@ -63,14 +66,17 @@ typedef struct {
 typedef struct {
   bosl_token_t* name;
   bosl_token_t* type;
+  size_t slot;
 } bosl_ast_statement_parameter_t;
 
 typedef struct {
   bosl_token_t* token;
-  list_manager_t* parameter; // list of ast statement parameter
+  vector_t* parameter; // list of ast statement parameter
   bosl_token_t* return_type;
   bosl_ast_statement_t* body; // list of statements
   bosl_token_t* load_identifier;
+  size_t slot;
+  size_t slot_count;
 } bosl_ast_statement_function_t;
 
 typedef struct {
@@ -92,12 +98,14 @@ typedef struct {
   bosl_token_t* name;
   bosl_token_t* type;
   bosl_ast_expression_t* initializer;
+  size_t slot;
 } bosl_ast_statement_variable_t;
 
 typedef struct {
   bosl_token_t* name;
   bosl_token_t* type;
   bosl_ast_expression_t* initializer;
+  size_t slot;
 } bosl_ast_statement_const_t;
 
 typedef struct {
@@ -113,8 +121,10 @@ typedef struct {
 typedef struct {
   bosl_token_t* token;
   bosl_ast_expression_t* level;
+  size_t resolved_level;
 } bosl_ast_statement_break_continue_t;
 
+// inner data follows the statement within the same arena allocation
 typedef struct bosl_ast_statement {
   bosl_ast_statement_type_t type;
   union {
@@ -132,11 +142,10 @@ typedef struct bosl_ast_statement {
     bosl_ast_statement_pointer_t* pointer;
     void* data;
   };
-  size_t size;
 } bosl_ast_statement_t;
 
-bosl_ast_statement_t* bosl_ast_statement_allocate( bosl_ast_statement_type_t );
-void bosl_ast_statement_destroy( bosl_ast_statement_t* );
+bosl_ast_statement_t* bosl_ast_statement_allocate(
+  arena_t*, bosl_ast_statement_type_t );
 
 #ifdef __cplusplus
 }
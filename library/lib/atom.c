@@ -0,0 +1,187 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "atom.h"
+#include "collection/hashmap.h"
+
+// name to atom mapping
+static hashmap_table_t* atom_map = NULL;
+// atom to name, length and hash mapping, first one is unused
+static bosl_atom_entry_t* atom_entry = NULL;
+static size_t atom_count = 0;
+static size_t atom_capacity = 0;
+
+/**
+ * @brief Helper to get entry of an atom
+ *
+ * @param atom
+ * @return entry or NULL if not existing
+ */
+static bosl_atom_entry_t* get_entry( bosl_atom_t atom ) {
+  // handle invalid atom
+  if ( BOSL_ATOM_NONE == atom || atom >= atom_count ) {
+    return NULL;
+  }
+  // return entry
+  return &atom_entry[ atom ];
+}
+
+/**
+ * @brief Intern a name
+ *
+ * @param name
+ * @param length
+ * @return atom of name or BOSL_ATOM_NONE on error
+ *
+ * @note atom table is created on first use, so interning is possible before
+ * and after scanning without explicit initialization
+ */
+bosl_atom_t bosl_atom_intern( const char* name, size_t length ) {
+  // create table if not existing
+  if ( !atom_map ) {
+    atom_map = hashmap_construct( NULL );
+    if ( !atom_map ) {
+      return BOSL_ATOM_NONE;
+    }
+    // avoid latency spikes when growing with large scripts
+    hashmap_incremental_resize( atom_map, true );
+    // reserve first atom as none
+    atom_count = 1;
+  }
+  // hash once for lookup, insertion and entry
+  size_t hash = hashmap_hash( name, length );
+  // return existing atom
+  uintptr_t existing = ( uintptr_t )hashmap_value_get_hashed(
+    atom_map, name, length, hash );
+  if ( existing ) {
+    return ( bosl_atom_t )existing;
+  }
+  // handle atom overflow
+  if ( UINT32_MAX <= atom_count ) {
+    return BOSL_ATOM_NONE;
+  }
+  // enlarge entries if necessary
+  if ( atom_count >= atom_capacity ) {
+    size_t capacity = atom_capacity ? atom_capacity * 2 : 64;
+    bosl_atom_entry_t* entry = realloc(
+      atom_entry, sizeof( bosl_atom_entry_t ) * capacity );
+    if ( !entry ) {
+      return BOSL_ATOM_NONE;
+    }
+    atom_entry = entry;
+    atom_capacity = capacity;
+  }
+  // add to map, stored key is used as name of the atom
+  bosl_atom_t atom = ( bosl_atom_t )atom_count;
+  const char* key = hashmap_value_set_hashed(
+    atom_map, name, ( void* )( uintptr_t )atom, length, hash );
+  if ( !key ) {
+    return BOSL_ATOM_NONE;
+  }
+  // populate entry
+  atom_entry[ atom ].name = key;
+  atom_entry[ atom ].length = length;
+  atom_entry[ atom ].hash = hash;
+  atom_count++;
+  // return atom
+  return atom;
+}
+
+/**
+ * @brief Find atom of a name without interning it
+ *
+ * @param name
+ * @param length
+ * @return atom of name or BOSL_ATOM_NONE if not interned
+ */
+bosl_atom_t bosl_atom_find( const char* name, size_t length ) {
+  // handle no table
+  if ( !atom_map ) {
+    return BOSL_ATOM_NONE;
+  }
+  // return found atom
+  return ( bosl_atom_t )( uintptr_t )hashmap_value_get_n(
+    atom_map, name, length );
+}
+
+/**
+ * @brief Get name of an atom
+ *
+ * @param atom
+ * @return null terminated name or NULL
+ */
+const char* bosl_atom_name( bosl_atom_t atom ) {
+  bosl_atom_entry_t* entry = get_entry( atom );
+  return entry ? entry->name : NULL;
+}
+
+/**
+ * @brief Get name length of an atom
+ *
+ * @param atom
+ * @return
+ */
+size_t bosl_atom_length( bosl_atom_t atom ) {
+  bosl_atom_entry_t* entry = get_entry( atom );
+  return entry ? entry->length : 0;
+}
+
+/**
+ * @brief Get precomputed hash of an atom
+ *
+ * @param atom
+ * @return
+ */
+size_t bosl_atom_hash( bosl_atom_t atom ) {
+  bosl_atom_entry_t* entry = get_entry( atom );
+  return entry ? entry->hash : 0;
+}
+
+/**
+ * @brief Get amount of atoms including none
+ *
+ * @return
+ *
+ * @note all atoms are below the returned value
+ */
+size_t bosl_atom_count( void ) {
+  return atom_count;
+}
+
+/**
+ * @brief Free atom table
+ */
+void bosl_atom_free( void ) {
+  // handle no table
+  if ( !atom_map ) {
+    return;
+  }
+  // destroy map and entries
+  hashmap_destruct( atom_map );
+  free( atom_entry );
+  // reset
+  atom_map = NULL;
+  atom_entry = NULL;
+  atom_count = 0;
+  atom_capacity = 0;
+}
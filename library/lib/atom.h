@@ -0,0 +1,55 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined( BOSL_ATOM_H )
+#define BOSL_ATOM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// atom of names which are not interned
+#define BOSL_ATOM_NONE 0
+
+typedef uint32_t bosl_atom_t;
+
+typedef struct bosl_atom_entry {
+  const char* name;
+  size_t length;
+  size_t hash;
+} bosl_atom_entry_t;
+
+bosl_atom_t bosl_atom_intern( const char*, size_t );
+bosl_atom_t bosl_atom_find( const char*, size_t );
+const char* bosl_atom_name( bosl_atom_t );
+size_t bosl_atom_length( bosl_atom_t );
+size_t bosl_atom_hash( bosl_atom_t );
+size_t bosl_atom_count( void );
+void bosl_atom_free( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -17,19 +17,14 @@
  * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include "binding.h"
 
-static hashmap_table_t* binding = NULL;
-
-/**
- * @brief Binding hashmap cleanup helper
- *
- * @param object
- */
-static void binding_cleanup( void* object ) {
-  bosl_object_destroy( object );
-}
+// bindings indexed by atom of their name
+static bosl_object_t** binding = NULL;
+static size_t binding_capacity = 0;
+static bool binding_initialized = false;
 
 /**
  * @brief Helper to build a return from c
@@ -86,10 +81,12 @@ static bosl_object_t* build_return(
  * @return
  */
 bool bosl_binding_init( void ) {
-  // create hash map
-  binding = hashmap_construct( binding_cleanup );
-  // return result of construct as success or false
-  return binding;
+  // bindings are allocated on first bind
+  binding = NULL;
+  binding_capacity = 0;
+  binding_initialized = true;
+  // return success
+  return true;
 }
 
 /**
@@ -97,11 +94,20 @@ bool bosl_binding_init( void ) {
  */
 void bosl_binding_free( void ) {
   // handle not initialized
-  if ( !binding ) {
+  if ( !binding_initialized ) {
     return;
   }
-  // destroy hashmap
-  hashmap_destruct( binding );
+  // destroy bound objects
+  for ( size_t idx = 0; idx < binding_capacity; idx++ ) {
+    if ( binding[ idx ] ) {
+      bosl_object_destroy( binding[ idx ] );
+    }
+  }
+  // free bindings
+  free( binding );
+  binding = NULL;
+  binding_capacity = 0;
+  binding_initialized = false;
 }
 
 /**
@@ -113,20 +119,47 @@ void bosl_binding_free( void ) {
  */
 bool bosl_binding_bind_function( const char* name, bosl_callback_t callback ) {
   // handle not initialized
-  if ( !binding ) {
+  if ( !binding_initialized ) {
     return false;
   }
   // don't allow to overwrite
   if ( bosl_binding_get( name ) ) {
     return false;
   }
+  // intern name
+  bosl_atom_t atom = bosl_atom_intern( name, strlen( name ) );
+  if ( BOSL_ATOM_NONE == atom ) {
+    return false;
+  }
+  // enlarge bindings if necessary
+  if ( atom >= binding_capacity ) {
+    size_t capacity = binding_capacity ? binding_capacity : 64;
+    while ( atom >= capacity ) {
+      capacity *= 2;
+    }
+    bosl_object_t** new_binding = realloc(
+      binding, sizeof( bosl_object_t* ) * capacity );
+    if ( !new_binding ) {
+      return false;
+    }
+    // clear out new part
+    memset(
+      new_binding + binding_capacity,
+      0,
+      sizeof( bosl_object_t* ) * ( capacity - binding_capacity )
+    );
+    binding = new_binding;
+    binding_capacity = capacity;
+  }
   // create a new callable object
   bosl_object_t* callable = bosl_object_allocate_callable( NULL, callback, NULL );
   if ( !callable ) {
     return false;
   }
   // add to bindings
-  return hashmap_value_set( binding, name, callable );
+  binding[ atom ] = callable;
+  // return success
+  return true;
 }
 
 /**
@@ -137,15 +170,19 @@ bool bosl_binding_bind_function( const char* name, bosl_callback_t callback ) {
  */
 bool bosl_binding_unbind_function( const char* name ) {
   // handle not initialized
-  if ( !binding ) {
+  if ( !binding_initialized ) {
     return false;
   }
   // return true in case there is no such binding
-  if ( !bosl_binding_get( name ) ) {
+  bosl_atom_t atom = bosl_atom_find( name, strlen( name ) );
+  if ( !bosl_binding_get_atom( atom ) ) {
     return true;
   }
-  // remove from hashmap
-  return hashmap_value_del( binding, name );
+  // remove from bindings
+  bosl_object_destroy( binding[ atom ] );
+  binding[ atom ] = NULL;
+  // return success
+  return true;
 }
 
 /**
@@ -155,12 +192,7 @@ bool bosl_binding_unbind_function( const char* name ) {
  * @return
  */
 bosl_object_t* bosl_binding_get( const char* name ) {
-  // handle not initialized
-  if ( !binding ) {
-    return NULL;
-  }
-  // try to get binding from hashmap
-  return hashmap_value_get( binding, name );
+  return bosl_binding_get_n( name, strlen( name ) );
 }
 
 /**
@@ -171,12 +203,22 @@ bosl_object_t* bosl_binding_get( const char* name ) {
  * @return
  */
 bosl_object_t* bosl_binding_get_n( const char* name, size_t length ) {
-  // handle not initialized
-  if ( !binding ) {
+  return bosl_binding_get_atom( bosl_atom_find( name, length ) );
+}
+
+/**
+ * @brief Get binding by atom of its name
+ *
+ * @param atom
+ * @return
+ */
+bosl_object_t* bosl_binding_get_atom( bosl_atom_t atom ) {
+  // handle not initialized or not bound
+  if ( !binding_initialized || atom >= binding_capacity ) {
     return NULL;
   }
-  // try to get binding from hashmap
-  return hashmap_value_get_n( binding, name, length );
+  // return binding
+  return binding[ atom ];
 }
 
 /**
@@ -20,10 +20,10 @@
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/hashmap.h"
+  #include "atom.h"
   #include "object.h"
 #else
-  #include <bosl/collection/hashmap.h>
+  #include <bosl/atom.h>
   #include <bosl/object.h>
 #endif
 
@@ -40,6 +40,7 @@ bool bosl_binding_bind_function( const char*, bosl_callback_t );
 bool bosl_binding_unbind_function( const char* );
 bosl_object_t* bosl_binding_get( const char* );
 bosl_object_t* bosl_binding_get_n( const char*, size_t );
+bosl_object_t* bosl_binding_get_atom( bosl_atom_t );
 
 bosl_object_t* bosl_binding_build_return_uint( bosl_object_type_t, uint64_t );
 bosl_object_t* bosl_binding_build_return_int( bosl_object_type_t, int64_t );
@@ -0,0 +1,418 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include "chunk.h"
+
+// macro to calculate enlarged capacity
+#define CHUNK_ENLARGE_CAPACITY( c ) ( 8 > ( c ) ? 8 : ( c ) * 2 )
+
+/**
+ * @brief Helper to ensure space for one more element within a buffer
+ *
+ * @param buffer
+ * @param count
+ * @param capacity
+ * @param size
+ * @return
+ */
+static bool ensure_capacity(
+  void** buffer,
+  size_t count,
+  size_t* capacity,
+  size_t size
+) {
+  // handle enough space
+  if ( count < *capacity ) {
+    return true;
+  }
+  // calculate new capacity
+  size_t new_capacity = CHUNK_ENLARGE_CAPACITY( *capacity );
+  // reallocate buffer
+  void* new_buffer = realloc( *buffer, new_capacity * size );
+  if ( !new_buffer ) {
+    return false;
+  }
+  // overwrite buffer and capacity
+  *buffer = new_buffer;
+  *capacity = new_capacity;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Allocate a new empty chunk
+ *
+ * @return
+ */
+bosl_chunk_t* bosl_chunk_allocate( void ) {
+  // allocate chunk
+  bosl_chunk_t* chunk = malloc( sizeof( bosl_chunk_t ) );
+  if ( !chunk ) {
+    return NULL;
+  }
+  // clear out
+  memset( chunk, 0, sizeof( bosl_chunk_t ) );
+  // return chunk
+  return chunk;
+}
+
+/**
+ * @brief Destroy chunk including constants
+ *
+ * @param chunk
+ */
+void bosl_chunk_destroy( bosl_chunk_t* chunk ) {
+  // handle invalid
+  if ( !chunk ) {
+    return;
+  }
+  // destroy heap objects of constants
+  for ( size_t index = 0; index < chunk->constant_count; index++ ) {
+    bosl_value_t* constant = &chunk->constant[ index ];
+    if (
+      BOSL_OBJECT_VALUE_STRING == constant->value_type
+      || BOSL_OBJECT_VALUE_CALLABLE == constant->value_type
+    ) {
+      bosl_object_destroy( constant->object );
+    }
+  }
+  // free buffers
+  free( chunk->code );
+  free( chunk->constant );
+  free( chunk->token );
+  free( chunk->function );
+  // free chunk
+  free( chunk );
+}
+
+/**
+ * @brief Write a byte to chunk
+ *
+ * @param chunk
+ * @param byte
+ * @return
+ */
+bool bosl_chunk_write( bosl_chunk_t* chunk, uint8_t byte ) {
+  // ensure capacity
+  if ( !ensure_capacity(
+    ( void** )&chunk->code,
+    chunk->count,
+    &chunk->capacity,
+    sizeof( uint8_t )
+  ) ) {
+    return false;
+  }
+  // push byte
+  chunk->code[ chunk->count++ ] = byte;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Write an operand to chunk
+ *
+ * @param chunk
+ * @param operand
+ * @return
+ */
+bool bosl_chunk_write_operand( bosl_chunk_t* chunk, uint32_t operand ) {
+  uint8_t byte[ BOSL_CHUNK_OPERAND_SIZE ];
+  // split up in host byte order
+  memcpy( byte, &operand, sizeof( operand ) );
+  // write byte by byte
+  for ( size_t index = 0; index < BOSL_CHUNK_OPERAND_SIZE; index++ ) {
+    if ( !bosl_chunk_write( chunk, byte[ index ] ) ) {
+      return false;
+    }
+  }
+  // return success
+  return true;
+}
+
+/**
+ * @brief Overwrite an already written operand at offset
+ *
+ * @param chunk
+ * @param offset
+ * @param operand
+ */
+void bosl_chunk_patch_operand(
+  bosl_chunk_t* chunk,
+  size_t offset,
+  uint32_t operand
+) {
+  memcpy( chunk->code + offset, &operand, sizeof( operand ) );
+}
+
+/**
+ * @brief Push a constant to chunk
+ *
+ * @param chunk
+ * @param value
+ * @param index
+ * @return
+ *
+ * @note heap objects of value are owned by the chunk afterwards
+ */
+bool bosl_chunk_push_constant(
+  bosl_chunk_t* chunk,
+  bosl_value_t* value,
+  uint32_t* index
+) {
+  // ensure capacity
+  if (
+    UINT32_MAX <= chunk->constant_count
+    || !ensure_capacity(
+      ( void** )&chunk->constant,
+      chunk->constant_count,
+      &chunk->constant_capacity,
+      sizeof( bosl_value_t )
+    )
+  ) {
+    return false;
+  }
+  // mark heap object as shared so that it's never released by the vm
+  if (
+    BOSL_OBJECT_VALUE_STRING == value->value_type
+    || BOSL_OBJECT_VALUE_CALLABLE == value->value_type
+  ) {
+    value->object->environment = true;
+  }
+  // push constant
+  *index = ( uint32_t )chunk->constant_count;
+  chunk->constant[ chunk->constant_count++ ] = *value;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Push a token to chunk
+ *
+ * @param chunk
+ * @param token
+ * @param index
+ * @return
+ */
+bool bosl_chunk_push_token(
+  bosl_chunk_t* chunk,
+  bosl_token_t* token,
+  uint32_t* index
+) {
+  // ensure capacity
+  if (
+    UINT32_MAX <= chunk->token_count
+    || !ensure_capacity(
+      ( void** )&chunk->token,
+      chunk->token_count,
+      &chunk->token_capacity,
+      sizeof( bosl_token_t* )
+    )
+  ) {
+    return false;
+  }
+  // push token
+  *index = ( uint32_t )chunk->token_count;
+  chunk->token[ chunk->token_count++ ] = token;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Push a function to chunk
+ *
+ * @param chunk
+ * @param statement
+ * @param index
+ * @return
+ */
+bool bosl_chunk_push_function(
+  bosl_chunk_t* chunk,
+  bosl_ast_statement_function_t* statement,
+  uint32_t* index
+) {
+  // ensure capacity
+  if (
+    UINT32_MAX <= chunk->function_count
+    || !ensure_capacity(
+      ( void** )&chunk->function,
+      chunk->function_count,
+      &chunk->function_capacity,
+      sizeof( bosl_chunk_function_t )
+    )
+  ) {
+    return false;
+  }
+  // push function
+  *index = ( uint32_t )chunk->function_count;
+  chunk->function[ chunk->function_count ].statement = statement;
+  chunk->function[ chunk->function_count ].entry = 0;
+  chunk->function_count++;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to print a token operand
+ *
+ * @param chunk
+ * @param offset
+ */
+static void print_token_operand( bosl_chunk_t* chunk, size_t offset ) {
+  uint32_t index = bosl_chunk_read_operand( chunk, offset );
+  bosl_token_t* token = chunk->token[ index ];
+  // handle no token
+  if ( !token ) {
+    fprintf( stdout, " -" );
+    return;
+  }
+  // print token lexeme
+  fprintf( stdout, " %.*s", ( int )token->length, token->start );
+}
+
+/**
+ * @brief Print disassembled chunk
+ *
+ * @param chunk
+ */
+void bosl_chunk_print( bosl_chunk_t* chunk ) {
+  static const char* name[] = {
+    [ BOSL_OPCODE_CONSTANT ] = "CONSTANT",
+    [ BOSL_OPCODE_POP ] = "POP",
+    [ BOSL_OPCODE_PRINT ] = "PRINT",
+    [ BOSL_OPCODE_GET_VARIABLE ] = "GET_VARIABLE",
+    [ BOSL_OPCODE_DEFINE_VARIABLE ] = "DEFINE_VARIABLE",
+    [ BOSL_OPCODE_DEFINE_CONSTANT ] = "DEFINE_CONSTANT",
+    [ BOSL_OPCODE_ASSIGN ] = "ASSIGN",
+    [ BOSL_OPCODE_BINARY ] = "BINARY",
+    [ BOSL_OPCODE_UNARY ] = "UNARY",
+    [ BOSL_OPCODE_JUMP ] = "JUMP",
+    [ BOSL_OPCODE_JUMP_IF_FALSE ] = "JUMP_IF_FALSE",
+    [ BOSL_OPCODE_OR ] = "OR",
+    [ BOSL_OPCODE_AND ] = "AND",
+    [ BOSL_OPCODE_SCOPE_PUSH ] = "SCOPE_PUSH",
+    [ BOSL_OPCODE_SCOPE_POP ] = "SCOPE_POP",
+    [ BOSL_OPCODE_FUNCTION ] = "FUNCTION",
+    [ BOSL_OPCODE_CALL ] = "CALL",
+    [ BOSL_OPCODE_RETURN ] = "RETURN",
+    [ BOSL_OPCODE_RETURN_NOTHING ] = "RETURN_NOTHING",
+    [ BOSL_OPCODE_BREAK ] = "BREAK",
+    [ BOSL_OPCODE_CONTINUE ] = "CONTINUE",
+    [ BOSL_OPCODE_HALT ] = "HALT",
+  };
+  size_t offset = 0;
+  while ( offset < chunk->count ) {
+    uint8_t opcode = chunk->code[ offset ];
+    // handle unknown opcode
+    if ( BOSL_OPCODE_HALT < opcode ) {
+      fprintf( stdout, "%04zu UNKNOWN %"PRIu8"\r\n", offset, opcode );
+      offset++;
+      continue;
+    }
+    fprintf( stdout, "%04zu %s", offset, name[ opcode ] );
+    offset++;
+    // print operands
+    switch ( opcode ) {
+      case BOSL_OPCODE_CONSTANT: {
+        uint32_t index = bosl_chunk_read_operand( chunk, offset );
+        char* str = bosl_value_stringify( &chunk->constant[ index ] );
+        fprintf( stdout, " %"PRIu32" '%s'", index, str ? str : "" );
+        free( str );
+        offset += BOSL_CHUNK_OPERAND_SIZE;
+        break;
+      }
+      case BOSL_OPCODE_GET_VARIABLE:
+      case BOSL_OPCODE_ASSIGN: {
+        uint32_t depth = bosl_chunk_read_operand( chunk, offset );
+        uint32_t slot = bosl_chunk_read_operand(
+          chunk, offset + BOSL_CHUNK_OPERAND_SIZE );
+        if ( UINT32_MAX == depth ) {
+          fprintf( stdout, " [unresolved]" );
+        } else {
+          fprintf( stdout, " [%"PRIu32":%"PRIu32"]", depth, slot );
+        }
+        print_token_operand( chunk, offset + BOSL_CHUNK_OPERAND_SIZE * 2 );
+        offset += BOSL_CHUNK_OPERAND_SIZE * 3;
+        break;
+      }
+      case BOSL_OPCODE_BINARY:
+      case BOSL_OPCODE_UNARY:
+        print_token_operand( chunk, offset );
+        offset += BOSL_CHUNK_OPERAND_SIZE;
+        break;
+      case BOSL_OPCODE_DEFINE_VARIABLE:
+      case BOSL_OPCODE_DEFINE_CONSTANT:
+        fprintf(
+          stdout, " [%"PRIu32"]", bosl_chunk_read_operand( chunk, offset ) );
+        print_token_operand( chunk, offset + BOSL_CHUNK_OPERAND_SIZE );
+        print_token_operand( chunk, offset + BOSL_CHUNK_OPERAND_SIZE * 2 );
+        offset += BOSL_CHUNK_OPERAND_SIZE * 3;
+        break;
+      case BOSL_OPCODE_SCOPE_PUSH:
+        fprintf(
+          stdout, " %"PRIu32, bosl_chunk_read_operand( chunk, offset ) );
+        offset += BOSL_CHUNK_OPERAND_SIZE;
+        break;
+      case BOSL_OPCODE_JUMP:
+      case BOSL_OPCODE_JUMP_IF_FALSE:
+      case BOSL_OPCODE_OR:
+      case BOSL_OPCODE_AND:
+        fprintf(
+          stdout, " -> %04"PRIu32, bosl_chunk_read_operand( chunk, offset ) );
+        offset += BOSL_CHUNK_OPERAND_SIZE;
+        break;
+      case BOSL_OPCODE_FUNCTION: {
+        uint32_t index = bosl_chunk_read_operand( chunk, offset );
+        bosl_token_t* token = chunk->function[ index ].statement->token;
+        fprintf(
+          stdout, " %.*s -> %04zu", ( int )token->length, token->start,
+          chunk->function[ index ].entry );
+        offset += BOSL_CHUNK_OPERAND_SIZE;
+        break;
+      }
+      case BOSL_OPCODE_CALL:
+        fprintf(
+          stdout, " %"PRIu32, bosl_chunk_read_operand( chunk, offset ) );
+        offset += BOSL_CHUNK_OPERAND_SIZE * 2;
+        break;
+      case BOSL_OPCODE_BREAK:
+      case BOSL_OPCODE_CONTINUE: {
+        uint32_t count = bosl_chunk_read_operand(
+          chunk, offset + BOSL_CHUNK_OPERAND_SIZE );
+        offset += BOSL_CHUNK_OPERAND_SIZE * 2;
+        for ( uint32_t index = 0; index < count; index++ ) {
+          fprintf(
+            stdout, " [%"PRIu32"] -> %04"PRIu32" ( %"PRIu32" scopes )",
+            index + 1,
+            bosl_chunk_read_operand( chunk, offset ),
+            bosl_chunk_read_operand( chunk, offset + BOSL_CHUNK_OPERAND_SIZE )
+          );
+          offset += BOSL_CHUNK_OPERAND_SIZE * 2;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    fprintf( stdout, "\r\n" );
+  }
+}
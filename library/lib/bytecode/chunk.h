@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "../scanner.h"
+  #include "../object.h"
+  #include "../value.h"
+  #include "../ast/statement.h"
+#else
+  #include <bosl/scanner.h>
+  #include <bosl/object.h>
+  #include <bosl/value.h>
+  #include <bosl/ast/statement.h>
+#endif
+
+#if !defined( BOSL_BYTECODE_CHUNK_H )
+#define BOSL_BYTECODE_CHUNK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// size of an instruction operand in bytes
+#define BOSL_CHUNK_OPERAND_SIZE sizeof( uint32_t )
+
+/**
+ * Opcodes with their operands, every operand is an uint32_t
+ *
+ * CONSTANT         constant index
+ * POP              -
+ * PRINT            -
+ * GET_VARIABLE     scope depth, slot, token index of name
+ * DEFINE_VARIABLE  slot, token index of name, token index of type
+ * DEFINE_CONSTANT  slot, token index of name, token index of type
+ * ASSIGN           scope depth, slot, token index of name
+ * BINARY           token index of operator
+ * UNARY            token index of operator
+ * JUMP             target offset
+ * JUMP_IF_FALSE    target offset
+ * OR               target offset
+ * AND              target offset
+ * SCOPE_PUSH       slot count
+ * SCOPE_POP        -
+ * FUNCTION         function index
+ * CALL             argument count, token index of parenthesis
+ * RETURN           -
+ * RETURN_NOTHING   -
+ * BREAK            token index of keyword, loop count, per loop target offset
+ *                  and amount of scopes to pop
+ * CONTINUE         same as break
+ * HALT             -
+ */
+typedef enum {
+  BOSL_OPCODE_CONSTANT,
+  BOSL_OPCODE_POP,
+  BOSL_OPCODE_PRINT,
+  BOSL_OPCODE_GET_VARIABLE,
+  BOSL_OPCODE_DEFINE_VARIABLE,
+  BOSL_OPCODE_DEFINE_CONSTANT,
+  BOSL_OPCODE_ASSIGN,
+  BOSL_OPCODE_BINARY,
+  BOSL_OPCODE_UNARY,
+  BOSL_OPCODE_JUMP,
+  BOSL_OPCODE_JUMP_IF_FALSE,
+  BOSL_OPCODE_OR,
+  BOSL_OPCODE_AND,
+  BOSL_OPCODE_SCOPE_PUSH,
+  BOSL_OPCODE_SCOPE_POP,
+  BOSL_OPCODE_FUNCTION,
+  BOSL_OPCODE_CALL,
+  BOSL_OPCODE_RETURN,
+  BOSL_OPCODE_RETURN_NOTHING,
+  BOSL_OPCODE_BREAK,
+  BOSL_OPCODE_CONTINUE,
+  BOSL_OPCODE_HALT,
+} bosl_opcode_t;
+
+typedef struct {
+  bosl_ast_statement_function_t* statement;
+  size_t entry;
+} bosl_chunk_function_t;
+
+typedef struct bosl_chunk {
+  uint8_t* code;
+  size_t count;
+  size_t capacity;
+
+  bosl_value_t* constant;
+  size_t constant_count;
+  size_t constant_capacity;
+
+  bosl_token_t** token;
+  size_t token_count;
+  size_t token_capacity;
+
+  bosl_chunk_function_t* function;
+  size_t function_count;
+  size_t function_capacity;
+} bosl_chunk_t;
+
+bosl_chunk_t* bosl_chunk_allocate( void );
+void bosl_chunk_destroy( bosl_chunk_t* );
+bool bosl_chunk_write( bosl_chunk_t*, uint8_t );
+bool bosl_chunk_write_operand( bosl_chunk_t*, uint32_t );
+void bosl_chunk_patch_operand( bosl_chunk_t*, size_t, uint32_t );
+bool bosl_chunk_push_constant( bosl_chunk_t*, bosl_value_t*, uint32_t* );
+bool bosl_chunk_push_token( bosl_chunk_t*, bosl_token_t*, uint32_t* );
+bool bosl_chunk_push_function(
+  bosl_chunk_t*, bosl_ast_statement_function_t*, uint32_t* );
+void bosl_chunk_print( bosl_chunk_t* );
+
+/**
+ * @brief Read an operand at offset
+ *
+ * @param chunk
+ * @param offset
+ * @return
+ *
+ * @note operands are stored unaligned in host byte order
+ */
+static inline uint32_t bosl_chunk_read_operand(
+  const bosl_chunk_t* chunk,
+  size_t offset
+) {
+  uint32_t operand;
+  memcpy( &operand, chunk->code + offset, sizeof( operand ) );
+  return operand;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
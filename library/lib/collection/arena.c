@@ -0,0 +1,194 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+// macro to round up to a multiple
+#define ARENA_ROUND_UP( v, m ) ( ( ( v ) + ( m ) - 1 ) / ( m ) * ( m ) )
+// aligned size of chunk header
+#define ARENA_CHUNK_HEADER ARENA_ROUND_UP( sizeof( arena_chunk_t ), ARENA_ALIGNMENT )
+
+/**
+ * @brief Construct arena
+ *
+ * @return
+ */
+arena_t* arena_construct( void ) {
+  // allocate arena
+  arena_t* arena = malloc( sizeof( arena_t ) );
+  if ( !arena ) {
+    return NULL;
+  }
+  // clear out
+  memset( arena, 0, sizeof( arena_t ) );
+  // return arena
+  return arena;
+}
+
+/**
+ * @brief Helper to free a chain of chunks
+ *
+ * @param chunk
+ */
+static void chunk_free( arena_chunk_t* chunk ) {
+  while ( chunk ) {
+    arena_chunk_t* next = chunk->next;
+    free( chunk );
+    chunk = next;
+  }
+}
+
+/**
+ * @brief Destruct arena
+ *
+ * @param arena
+ *
+ * @note all allocations of the arena are invalid afterwards
+ */
+void arena_destruct( arena_t* arena ) {
+  // handle invalid
+  if ( !arena ) {
+    return;
+  }
+  // free chunks in use and spare chunks
+  chunk_free( arena->chunk );
+  chunk_free( arena->spare );
+  // free arena
+  free( arena );
+}
+
+/**
+ * @brief Helper to start a new chunk with at least given size
+ *
+ * @param arena
+ * @param size
+ * @return
+ */
+static bool chunk_push( arena_t* arena, size_t size ) {
+  arena_chunk_t* chunk = NULL;
+  // reuse spare chunk if big enough
+  if ( arena->spare && arena->spare->size >= size ) {
+    chunk = arena->spare;
+    arena->spare = chunk->next;
+  // otherwise allocate a new one
+  } else {
+    // oversized requests get a dedicated chunk
+    if ( size < ARENA_CHUNK_SIZE ) {
+      size = ARENA_CHUNK_SIZE;
+    }
+    chunk = malloc( ARENA_CHUNK_HEADER + size );
+    if ( !chunk ) {
+      return false;
+    }
+    chunk->size = size;
+  }
+  // link chunk in front of used ones
+  chunk->next = arena->chunk;
+  arena->chunk = chunk;
+  // setup bump pointer
+  arena->bump = ( uint8_t* )chunk + ARENA_CHUNK_HEADER;
+  arena->end = arena->bump + chunk->size;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Allocate memory from arena
+ *
+ * @param arena
+ * @param size
+ * @return
+ *
+ * @note memory is not released individually but by reset or clear
+ */
+void* arena_allocate( arena_t* arena, size_t size ) {
+  // handle invalid
+  if ( !arena || !size ) {
+    return NULL;
+  }
+  // keep every allocation aligned
+  size = ARENA_ROUND_UP( size, ARENA_ALIGNMENT );
+  // start a new chunk if current one is exhausted
+  if (
+    !arena->bump
+    || ( size_t )( arena->end - arena->bump ) < size
+  ) {
+    if ( !chunk_push( arena, size ) ) {
+      return NULL;
+    }
+  }
+  // bump allocate
+  void* memory = arena->bump;
+  arena->bump += size;
+  // return memory
+  return memory;
+}
+
+/**
+ * @brief Get current position of arena
+ *
+ * @param arena
+ * @return
+ */
+arena_mark_t arena_mark( arena_t* arena ) {
+  arena_mark_t mark = { .chunk = arena->chunk, .bump = arena->bump };
+  return mark;
+}
+
+/**
+ * @brief Reset arena to a previously taken mark
+ *
+ * @param arena
+ * @param mark
+ *
+ * @note everything allocated after the mark is invalid afterwards
+ */
+void arena_reset( arena_t* arena, arena_mark_t mark ) {
+  // move chunks started after the mark to spare list
+  while ( arena->chunk != mark.chunk ) {
+    arena_chunk_t* chunk = arena->chunk;
+    arena->chunk = chunk->next;
+    chunk->next = arena->spare;
+    arena->spare = chunk;
+  }
+  // restore bump pointer
+  arena->bump = mark.bump;
+  arena->end = mark.chunk
+    ? ( uint8_t* )mark.chunk + ARENA_CHUNK_HEADER + mark.chunk->size
+    : NULL;
+}
+
+/**
+ * @brief Release everything allocated from arena
+ *
+ * @param arena
+ *
+ * @note chunks are kept for reuse, all allocations are invalid afterwards
+ */
+void arena_clear( arena_t* arena ) {
+  // handle invalid
+  if ( !arena ) {
+    return;
+  }
+  // reset to empty arena
+  arena_mark_t mark = { .chunk = NULL, .bump = NULL };
+  arena_reset( arena, mark );
+}
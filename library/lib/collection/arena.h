@@ -0,0 +1,70 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined( ARENA_H )
+#define ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// alignment of arena allocations, sufficient for every fundamental type
+#define ARENA_ALIGNMENT _Alignof( max_align_t )
+// amount of usable memory requested per chunk
+#define ARENA_CHUNK_SIZE 16384
+
+// forward declaration
+typedef struct arena_chunk arena_chunk_t;
+typedef struct arena arena_t;
+
+// chunk header, memory follows aligned
+struct arena_chunk {
+  arena_chunk_t* next;
+  size_t size;
+};
+
+// position within arena to reset to
+typedef struct {
+  arena_chunk_t* chunk;
+  uint8_t* bump;
+} arena_mark_t;
+
+struct arena {
+  arena_chunk_t* chunk;
+  arena_chunk_t* spare;
+  uint8_t* bump;
+  uint8_t* end;
+};
+
+arena_t* arena_construct( void );
+void arena_destruct( arena_t* );
+void* arena_allocate( arena_t*, size_t );
+arena_mark_t arena_mark( arena_t* );
+void arena_reset( arena_t*, arena_mark_t );
+void arena_clear( arena_t* );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,65 +22,1101 @@
 #include <string.h>
 #include "hashmap.h"
 
+#if defined( HASHMAP_GROUP_PROBE ) && defined( HASHMAP_COMPACT )
+  #error "Group probing and compact layout can't be combined"
+#endif
+
+#if defined( HASHMAP_GROUP_PROBE )
+  #if defined( __SSE2__ )
+    #include <emmintrin.h>
+    // one bit per slot within match mask
+    #define HASHMAP_GROUP_WIDTH 16
+    #define HASHMAP_GROUP_SHIFT 0
+  #elif defined( __ARM_NEON )
+    #include <arm_neon.h>
+    // four bits per slot within match mask
+    #define HASHMAP_GROUP_WIDTH 16
+    #define HASHMAP_GROUP_SHIFT 2
+  #else
+    // eight bits per slot within match mask
+    #define HASHMAP_GROUP_WIDTH 8
+    #define HASHMAP_GROUP_SHIFT 3
+  #endif
+  // control bytes of unused slots, used ones store 7 bit of the hash
+  #define HASHMAP_CONTROL_EMPTY 0x80
+  #define HASHMAP_CONTROL_DELETED 0xFE
+#elif defined( HASHMAP_COMPACT )
+  // slot index values of unused slots
+  #define HASHMAP_INDEX_EMPTY SIZE_MAX
+  #define HASHMAP_INDEX_DUMMY ( SIZE_MAX - 1 )
+#else
+  // length marking entries removed from previous slots while migrating
+  #define HASHMAP_RETIRED SIZE_MAX
+#endif
+
 static void default_cleanup( __unused void* a ) {}
 
+// secrets used by hash function
+static const uint64_t hashmap_secret[ 4 ] = {
+  0x2d358dccaa6c78a5ull,
+  0x8bb84b93962eacc9ull,
+  0x4b33a62ed433d4a3ull,
+  0x4d5a2da51de1aa47ull,
+};
+
+/**
+ * @brief Helper to multiply two words into a 128 bit result
+ *
+ * @param a set to lower half of the result
+ * @param b set to upper half of the result
+ */
+static void hash_multiply( uint64_t* a, uint64_t* b ) {
+#if defined( __SIZEOF_INT128__ )
+  __extension__ typedef unsigned __int128 hash_uint128_t;
+  hash_uint128_t result = ( hash_uint128_t )*a * *b;
+  *a = ( uint64_t )result;
+  *b = ( uint64_t )( result >> 64 );
+#else
+  // split into 32 bit halves
+  uint64_t ha = *a >> 32, la = ( uint32_t )*a;
+  uint64_t hb = *b >> 32, lb = ( uint32_t )*b;
+  uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  uint64_t t = rl + ( rm0 << 32 );
+  uint64_t carry = t < rl;
+  uint64_t low = t + ( rm1 << 32 );
+  carry += low < t;
+  *a = low;
+  *b = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + carry;
+#endif
+}
+
+/**
+ * @brief Helper to multiply two words and fold the 128 bit result
+ *
+ * @param a
+ * @param b
+ * @return
+ */
+static uint64_t hash_mix( uint64_t a, uint64_t b ) {
+  hash_multiply( &a, &b );
+  return a ^ b;
+}
+
+/**
+ * @brief Helper to read 8 byte word
+ *
+ * @param p
+ * @return
+ */
+static uint64_t hash_read8( const uint8_t* p ) {
+  uint64_t v;
+  memcpy( &v, p, sizeof( v ) );
+  return v;
+}
+
+/**
+ * @brief Helper to read 4 byte word
+ *
+ * @param p
+ * @return
+ */
+static uint64_t hash_read4( const uint8_t* p ) {
+  uint32_t v;
+  memcpy( &v, p, sizeof( v ) );
+  return v;
+}
+
+/**
+ * @brief Generate a hash of key with given length
+ *
+ * @param key
+ * @param len
+ * @return
+ *
+ * @note word at a time hash following wyhash, keys up to 16 byte are read
+ * with at most four overlapping loads
+ */
+size_t hashmap_hash( const char* key, size_t len ) {
+  // transform to const uint8 pointer
+  const uint8_t* p = ( const uint8_t* )key;
+  uint64_t seed = hash_mix( hashmap_secret[ 0 ], hashmap_secret[ 1 ] );
+  uint64_t a;
+  uint64_t b;
+  // read short keys with overlapping loads
+  if ( 16 >= len ) {
+    if ( 4 <= len ) {
+      size_t shift = ( len >> 3 ) << 2;
+      a = ( hash_read4( p ) << 32 ) | hash_read4( p + shift );
+      b = ( hash_read4( p + len - 4 ) << 32 )
+        | hash_read4( p + len - 4 - shift );
+    } else if ( 0 < len ) {
+      a = ( ( uint64_t )p[ 0 ] << 16 )
+        | ( ( uint64_t )p[ len >> 1 ] << 8 )
+        | p[ len - 1 ];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    // consume 16 byte per iteration
+    size_t remaining = len;
+    while ( 16 < remaining ) {
+      seed = hash_mix(
+        hash_read8( p ) ^ hashmap_secret[ 1 ],
+        hash_read8( p + 8 ) ^ seed );
+      remaining -= 16;
+      p += 16;
+    }
+    // last 16 byte overlapping with previous ones
+    a = hash_read8( p + remaining - 16 );
+    b = hash_read8( p + remaining - 8 );
+  }
+  // final mix
+  a ^= hashmap_secret[ 1 ];
+  b ^= seed;
+  hash_multiply( &a, &b );
+  return ( size_t )hash_mix(
+    a ^ hashmap_secret[ 0 ] ^ len,
+    b ^ hashmap_secret[ 1 ]
+  );
+}
+
+/**
+ * @brief Helper to check whether entry matches key
+ *
+ * @param entry
+ * @param key
+ * @param len
+ * @param hash
+ * @return
+ */
+static bool hashmap_entry_match(
+  hashmap_entry_t* entry,
+  const char* key,
+  size_t len,
+  size_t hash
+) {
+  // check hash and length before comparing content
+  return hash == entry->hash
+    && len == entry->length
+    && !memcmp( key, entry->key, len );
+}
+
+#if defined( HASHMAP_GROUP_PROBE )
+#if defined( __SSE2__ )
+/**
+ * @brief Helper to get slots of a group with given control byte
+ *
+ * @param control
+ * @param byte
+ * @return
+ */
+static uint64_t group_match( const uint8_t* control, uint8_t byte ) {
+  __m128i group = _mm_loadu_si128( ( const __m128i* )control );
+  return ( uint32_t )_mm_movemask_epi8(
+    _mm_cmpeq_epi8( group, _mm_set1_epi8( ( char )byte ) ) );
+}
+
+/**
+ * @brief Helper to get empty or deleted slots of a group
+ *
+ * @param control
+ * @return
+ */
+static uint64_t group_match_free( const uint8_t* control ) {
+  // empty and deleted are the only ones with highest bit set
+  return ( uint32_t )_mm_movemask_epi8(
+    _mm_loadu_si128( ( const __m128i* )control ) );
+}
+#elif defined( __ARM_NEON )
+/**
+ * @brief Helper to get mask with four bits per slot out of compare result
+ *
+ * @param compare
+ * @return
+ */
+static uint64_t group_mask( uint8x16_t compare ) {
+  // narrow each byte to four bits
+  uint8x8_t narrowed = vshrn_n_u16( vreinterpretq_u16_u8( compare ), 4 );
+  // keep only one bit per slot
+  return vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 )
+    & 0x8888888888888888ull;
+}
+
+/**
+ * @brief Helper to get slots of a group with given control byte
+ *
+ * @param control
+ * @param byte
+ * @return
+ */
+static uint64_t group_match( const uint8_t* control, uint8_t byte ) {
+  return group_mask( vceqq_u8( vld1q_u8( control ), vdupq_n_u8( byte ) ) );
+}
+
+/**
+ * @brief Helper to get empty or deleted slots of a group
+ *
+ * @param control
+ * @return
+ */
+static uint64_t group_match_free( const uint8_t* control ) {
+  // empty and deleted are the only ones with highest bit set
+  return group_mask(
+    vcgeq_u8( vld1q_u8( control ), vdupq_n_u8( HASHMAP_CONTROL_EMPTY ) ) );
+}
+#else
+/**
+ * @brief Helper to load a group as word with first slot in lowest byte
+ *
+ * @param control
+ * @return
+ */
+static uint64_t group_load( const uint8_t* control ) {
+  uint64_t group;
+  memcpy( &group, control, sizeof( group ) );
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  group = __builtin_bswap64( group );
+#endif
+  return group;
+}
+
+/**
+ * @brief Helper to get slots of a group with given control byte
+ *
+ * @param control
+ * @param byte
+ * @return
+ *
+ * @note may report false positives behind a match, which are sorted out by
+ * comparing the key afterwards
+ */
+static uint64_t group_match( const uint8_t* control, uint8_t byte ) {
+  // xor sets matching bytes to zero
+  uint64_t group = group_load( control ) ^ ( 0x0101010101010101ull * byte );
+  // detect zero bytes
+  return ( group - 0x0101010101010101ull ) & ~group & 0x8080808080808080ull;
+}
+
+/**
+ * @brief Helper to get empty or deleted slots of a group
+ *
+ * @param control
+ * @return
+ */
+static uint64_t group_match_free( const uint8_t* control ) {
+  // empty and deleted are the only ones with highest bit set
+  return group_load( control ) & 0x8080808080808080ull;
+}
+#endif
+
+/**
+ * @brief Helper to check whether a group contains an empty slot
+ *
+ * @param control
+ * @return
+ */
+static bool group_has_empty( const uint8_t* control ) {
+  return 0 != group_match( control, HASHMAP_CONTROL_EMPTY );
+}
+
+/**
+ * @brief Helper to get slot index within group from match mask
+ *
+ * @param match
+ * @return
+ */
+static size_t group_slot( uint64_t match ) {
+  return ( size_t )__builtin_ctzll( match ) >> HASHMAP_GROUP_SHIFT;
+}
+
+/**
+ * @brief Helper to find an entry
+ *
+ * @param entries
+ * @param control
+ * @param capacity
+ * @param key
+ * @param len
+ * @param hash
+ * @return found entry or NULL
+ *
+ * @note groups are probed quadratic, so all groups are visited
+ */
+static hashmap_entry_t* hashmap_find_entry(
+  hashmap_entry_t* entries,
+  uint8_t* control,
+  size_t capacity,
+  const char* key,
+  size_t len,
+  size_t hash
+) {
+  // handle no entries yet
+  if ( !entries ) {
+    return NULL;
+  }
+  size_t mask = capacity / HASHMAP_GROUP_WIDTH - 1;
+  size_t group = ( hash >> 7 ) & mask;
+  uint8_t fragment = ( uint8_t )( hash & 0x7F );
+  // loop through groups until one with empty slot is found
+  for ( size_t step = 1;; step++ ) {
+    size_t offset = group * HASHMAP_GROUP_WIDTH;
+    // check all slots with matching hash fragment
+    for (
+      uint64_t match = group_match( control + offset, fragment );
+      match;
+      match &= match - 1
+    ) {
+      hashmap_entry_t* entry = &entries[ offset + group_slot( match ) ];
+      if ( hashmap_entry_match( entry, key, len, hash ) ) {
+        return entry;
+      }
+    }
+    // key isn't stored if group has an empty slot
+    if ( group_has_empty( control + offset ) ) {
+      return NULL;
+    }
+    // continue with next group
+    group = ( group + step ) & mask;
+  }
+}
+
+/**
+ * @brief Helper to insert an entry which doesn't exist yet
+ *
+ * @param table
+ * @param entry
+ * @return slot of inserted entry
+ */
+static hashmap_entry_t* hashmap_insert_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t entry
+) {
+  size_t mask = table->capacity / HASHMAP_GROUP_WIDTH - 1;
+  size_t group = ( entry.hash >> 7 ) & mask;
+  // loop through groups until one with free slot is found
+  for ( size_t step = 1;; step++ ) {
+    size_t offset = group * HASHMAP_GROUP_WIDTH;
+    uint64_t match = group_match_free( table->control + offset );
+    if ( match ) {
+      size_t index = offset + group_slot( match );
+      // reusing a deleted slot
+      if ( HASHMAP_CONTROL_DELETED == table->control[ index ] ) {
+        table->deleted--;
+      }
+      // set control byte and entry
+      table->control[ index ] = ( uint8_t )( entry.hash & 0x7F );
+      table->entries[ index ] = entry;
+      return &table->entries[ index ];
+    }
+    // continue with next group
+    group = ( group + step ) & mask;
+  }
+}
+
+/**
+ * @brief Helper to remove an entry
+ *
+ * @param table
+ * @param entry
+ *
+ * @note slot is marked as deleted only when the group has no empty slot, as
+ * probing would have stopped within that group otherwise
+ */
+static void hashmap_remove_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  size_t index = ( size_t )( entry - table->entries );
+  size_t offset = index & ~( ( size_t )HASHMAP_GROUP_WIDTH - 1 );
+  // mark slot as free
+  if ( group_has_empty( table->control + offset ) ) {
+    table->control[ index ] = HASHMAP_CONTROL_EMPTY;
+  } else {
+    table->control[ index ] = HASHMAP_CONTROL_DELETED;
+    table->deleted++;
+  }
+  // unset entry
+  memset( entry, 0, sizeof( hashmap_entry_t ) );
+}
+
+/**
+ * @brief Helper to remove an entry of previous slots while migrating
+ *
+ * @param table
+ * @param entry
+ */
+static void hashmap_retire_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  // mark as deleted, previous slots are only probed until migrated
+  table->old_control[ entry - table->old_entries ] = HASHMAP_CONTROL_DELETED;
+  memset( entry, 0, sizeof( hashmap_entry_t ) );
+}
+
+/**
+ * @brief Helper to check whether a previous slot is still in use
+ *
+ * @param table
+ * @param index
+ * @return
+ */
+static bool hashmap_previous_live( hashmap_table_t* table, size_t index ) {
+  // used slots have highest bit of the control byte cleared
+  return !( table->old_control[ index ] & HASHMAP_CONTROL_EMPTY );
+}
+
+/**
+ * @brief Helper to allocate new empty slots
+ *
+ * @param table
+ * @param capacity
+ * @return
+ */
+static bool allocate_slots( hashmap_table_t* table, size_t capacity ) {
+  // at least one group is necessary
+  if ( capacity < HASHMAP_GROUP_WIDTH ) {
+    capacity = HASHMAP_GROUP_WIDTH;
+  }
+  // allocate new hashmap entries and control bytes
+  hashmap_entry_t* new_list = calloc( capacity, sizeof( hashmap_entry_t ) );
+  uint8_t* new_control = malloc( capacity );
+  // handle error
+  if ( !new_list || !new_control ) {
+    free( new_list );
+    free( new_control );
+    return false;
+  }
+  memset( new_control, HASHMAP_CONTROL_EMPTY, capacity );
+  // set entries and new capacity
+  table->entries = new_list;
+  table->control = new_control;
+  table->capacity = capacity;
+  table->deleted = 0;
+  // return success
+  return true;
+}
+#elif defined( HASHMAP_COMPACT )
+/**
+ * @brief Helper to get byte width of slot index for a capacity
+ *
+ * @param capacity
+ * @return
+ *
+ * @note the two largest values of a width are reserved for empty and dummy
+ */
+static size_t index_width( size_t capacity ) {
+  if ( capacity < UINT8_MAX ) {
+    return sizeof( uint8_t );
+  }
+  if ( capacity < UINT16_MAX ) {
+    return sizeof( uint16_t );
+  }
+  if ( capacity < UINT32_MAX ) {
+    return sizeof( uint32_t );
+  }
+  return sizeof( uint64_t );
+}
+
+/**
+ * @brief Helper to get dense position stored within a slot
+ *
+ * @param control
+ * @param capacity
+ * @param slot
+ * @return dense position, HASHMAP_INDEX_EMPTY or HASHMAP_INDEX_DUMMY
+ */
+static size_t index_get( const uint8_t* control, size_t capacity, size_t slot ) {
+  uint64_t value;
+  uint64_t max;
+  // read value with width of the index
+  switch ( index_width( capacity ) ) {
+    case sizeof( uint8_t ):
+      value = control[ slot ];
+      max = UINT8_MAX;
+      break;
+    case sizeof( uint16_t ):
+      value = ( ( const uint16_t* )control )[ slot ];
+      max = UINT16_MAX;
+      break;
+    case sizeof( uint32_t ):
+      value = ( ( const uint32_t* )control )[ slot ];
+      max = UINT32_MAX;
+      break;
+    default:
+      value = ( ( const uint64_t* )control )[ slot ];
+      max = UINT64_MAX;
+  }
+  // map reserved values of the width to empty and dummy
+  if ( value >= max - 1 ) {
+    return ( size_t )( SIZE_MAX - ( max - value ) );
+  }
+  return ( size_t )value;
+}
+
+/**
+ * @brief Helper to set dense position of a slot
+ *
+ * @param control
+ * @param capacity
+ * @param slot
+ * @param value dense position, HASHMAP_INDEX_EMPTY or HASHMAP_INDEX_DUMMY
+ */
+static void index_set(
+  uint8_t* control,
+  size_t capacity,
+  size_t slot,
+  size_t value
+) {
+  size_t width = index_width( capacity );
+  uint64_t max = sizeof( uint64_t ) == width
+    ? UINT64_MAX : ( ( uint64_t )1 << ( width * 8 ) ) - 1;
+  // map empty and dummy to reserved values of the width
+  uint64_t v = value >= HASHMAP_INDEX_DUMMY
+    ? max - ( SIZE_MAX - value ) : value;
+  // write value with width of the index
+  switch ( width ) {
+    case sizeof( uint8_t ):
+      control[ slot ] = ( uint8_t )v;
+      break;
+    case sizeof( uint16_t ):
+      ( ( uint16_t* )control )[ slot ] = ( uint16_t )v;
+      break;
+    case sizeof( uint32_t ):
+      ( ( uint32_t* )control )[ slot ] = ( uint32_t )v;
+      break;
+    default:
+      ( ( uint64_t* )control )[ slot ] = v;
+  }
+}
+
+/**
+ * @brief Helper to find an entry
+ *
+ * @param entries
+ * @param control
+ * @param capacity
+ * @param key
+ * @param len
+ * @param hash
+ * @return found entry or NULL
+ */
+static hashmap_entry_t* hashmap_find_entry(
+  hashmap_entry_t* entries,
+  uint8_t* control,
+  size_t capacity,
+  const char* key,
+  size_t len,
+  size_t hash
+) {
+  // handle no entries yet
+  if ( !entries ) {
+    return NULL;
+  }
+  size_t slot = hash & ( capacity - 1 );
+  // loop until empty slot, dummies continue the probe chain
+  while ( true ) {
+    size_t position = index_get( control, capacity, slot );
+    if ( HASHMAP_INDEX_EMPTY == position ) {
+      return NULL;
+    }
+    if (
+      HASHMAP_INDEX_DUMMY != position
+      && hashmap_entry_match( &entries[ position ], key, len, hash )
+    ) {
+      return &entries[ position ];
+    }
+    // increment and wrap around at end
+    slot = ( slot + 1 ) & ( capacity - 1 );
+  }
+}
+
+/**
+ * @brief Helper to insert an entry which doesn't exist yet
+ *
+ * @param table
+ * @param entry
+ * @return slot of inserted entry
+ *
+ * @note entry is appended to dense entries, dummies aren't reused so that
+ * used slots never exceed used dense entries
+ */
+static hashmap_entry_t* hashmap_insert_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t entry
+) {
+  size_t position = table->used++;
+  size_t slot = entry.hash & ( table->capacity - 1 );
+  // loop until empty slot found
+  while ( HASHMAP_INDEX_EMPTY != index_get(
+    table->control, table->capacity, slot )
+  ) {
+    slot = ( slot + 1 ) & ( table->capacity - 1 );
+  }
+  // append entry and point slot to it
+  table->entries[ position ] = entry;
+  index_set( table->control, table->capacity, slot, position );
+  // return appended entry
+  return &table->entries[ position ];
+}
+
+/**
+ * @brief Helper to remove an entry
+ *
+ * @param table
+ * @param entry
+ *
+ * @note dense entry is left as hole until the next resize
+ */
+static void hashmap_remove_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  size_t position = ( size_t )( entry - table->entries );
+  size_t slot = entry->hash & ( table->capacity - 1 );
+  // find slot pointing to the entry
+  while ( position != index_get( table->control, table->capacity, slot ) ) {
+    slot = ( slot + 1 ) & ( table->capacity - 1 );
+  }
+  // mark slot as dummy to keep probe chains intact
+  index_set( table->control, table->capacity, slot, HASHMAP_INDEX_DUMMY );
+  // unset entry
+  memset( entry, 0, sizeof( hashmap_entry_t ) );
+}
+
+/**
+ * @brief Helper to remove an entry of previous slots while migrating
+ *
+ * @param table
+ * @param entry
+ *
+ * @note unused as compact layout is always resized at once
+ */
+static void hashmap_retire_entry(
+  __unused hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  memset( entry, 0, sizeof( hashmap_entry_t ) );
+}
+
+/**
+ * @brief Helper to check whether a previous slot is still in use
+ *
+ * @param table
+ * @param index
+ * @return
+ */
+static bool hashmap_previous_live( hashmap_table_t* table, size_t index ) {
+  return table->old_entries[ index ].key;
+}
+
+/**
+ * @brief Helper to allocate new empty slots
+ *
+ * @param table
+ * @param capacity
+ * @return
+ *
+ * @note dense entries are allocated only up to the maximum load
+ */
+static bool allocate_slots( hashmap_table_t* table, size_t capacity ) {
+  size_t usable = capacity * table->max_load / 100;
+  // allocate new dense entries and slot index
+  hashmap_entry_t* new_list = calloc(
+    usable ? usable : 1, sizeof( hashmap_entry_t ) );
+  uint8_t* new_control = malloc( capacity * index_width( capacity ) );
+  // handle error
+  if ( !new_list || !new_control ) {
+    free( new_list );
+    free( new_control );
+    return false;
+  }
+  // all bits set marks every slot as empty
+  memset( new_control, 0xFF, capacity * index_width( capacity ) );
+  // set entries and new capacity
+  table->entries = new_list;
+  table->control = new_control;
+  table->capacity = capacity;
+  table->used = 0;
+  table->usable = usable;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to fit dense entries to current maximum load
+ *
+ * @param table
+ * @return
+ *
+ * @note dense entries already appended are kept even if they exceed the new
+ * maximum load, so that the next insert enlarges the table
+ */
+static bool adjust_usable( hashmap_table_t* table ) {
+  size_t usable = table->capacity * table->max_load / 100;
+  size_t size = usable > table->used ? usable : table->used;
+  // reallocate dense entries
+  hashmap_entry_t* new_list = realloc(
+    table->entries, ( size ? size : 1 ) * sizeof( hashmap_entry_t ) );
+  if ( !new_list ) {
+    return false;
+  }
+  // clear out entries not appended yet
+  memset(
+    new_list + table->used, 0,
+    ( size - table->used ) * sizeof( hashmap_entry_t ) );
+  // set entries and usable amount
+  table->entries = new_list;
+  table->usable = usable;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to adjust hashmap size
+ *
+ * @param table
+ * @param capacity
+ * @return
+ *
+ * @note entries are moved at once to keep insertion order, holes of removed
+ * entries are dropped
+ */
+static bool adjust_capacity( hashmap_table_t* table, size_t capacity ) {
+  // save old ones
+  hashmap_entry_t* old_list = table->entries;
+  uint8_t* old_control = table->control;
+  size_t old_used = table->used;
+  // allocate new slots
+  if ( !allocate_slots( table, capacity ) ) {
+    return false;
+  }
+  // append live entries in insertion order
+  for ( size_t index = 0; index < old_used; index++ ) {
+    if ( old_list[ index ].key ) {
+      hashmap_insert_entry( table, old_list[ index ] );
+    }
+  }
+  // free old ones
+  free( old_list );
+  free( old_control );
+  // return success
+  return true;
+}
+#else
+/**
+ * @brief Helper to get probe distance of an entry from its home slot
+ *
+ * @param entry
+ * @param index
+ * @param capacity
+ * @return
+ */
+static size_t hashmap_distance(
+  hashmap_entry_t* entry,
+  size_t index,
+  size_t capacity
+) {
+  return ( index - ( entry->hash & ( capacity - 1 ) ) ) & ( capacity - 1 );
+}
+
+/**
+ * @brief Helper to find an entry
+ *
+ * @param entries
+ * @param control
+ * @param capacity
+ * @param key
+ * @param len
+ * @param hash
+ * @return found entry or NULL
+ */
+static hashmap_entry_t* hashmap_find_entry(
+  hashmap_entry_t* entries,
+  __unused uint8_t* control,
+  size_t capacity,
+  const char* key,
+  size_t len,
+  size_t hash
+) {
+  // handle no entries yet
+  if ( !entries ) {
+    return NULL;
+  }
+  size_t index = hash & ( capacity - 1 );
+  // loop until empty or entry is closer to its home than the key would be
+  for ( size_t distance = 0;; distance++ ) {
+    hashmap_entry_t* entry = &entries[ index ];
+    // stop if key cannot be placed behind
+    if (
+      !entry->key
+      || distance > hashmap_distance( entry, index, capacity )
+    ) {
+      return NULL;
+    }
+    if ( hashmap_entry_match( entry, key, len, hash ) ) {
+      return entry;
+    }
+    // increment and wrap around at end
+    index = ( index + 1 ) & ( capacity - 1 );
+  }
+}
+
 /**
- * @brief Helper to generate a hash of key using Jenkin's one_at_a_time
+ * @brief Helper to insert an entry which doesn't exist yet
  *
- * @param key
- * @return
+ * @param table
+ * @param entry
+ * @return slot of inserted entry
+ *
+ * @note entries with a shorter distance to their home are displaced
  */
-static size_t hashmap_generate_hash( const char* key ) {
-  // determine length of null terminated key
-  size_t len = strlen( key );
-  // transform to const uint8 pointer
-  const uint8_t* byte = ( const uint8_t* )key;
-  // hash variable
-  size_t hash = 0;
+static hashmap_entry_t* hashmap_insert_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t entry
+) {
+  hashmap_entry_t* inserted = NULL;
+  size_t index = entry.hash & ( table->capacity - 1 );
+  size_t distance = 0;
+  // loop until empty slot found
+  while ( table->entries[ index ].key ) {
+    // swap with richer entry
+    size_t existing = hashmap_distance(
+      &table->entries[ index ], index, table->capacity );
+    if ( existing < distance ) {
+      hashmap_entry_t tmp = table->entries[ index ];
+      table->entries[ index ] = entry;
+      entry = tmp;
+      distance = existing;
+      // remember where the new entry went
+      if ( !inserted ) {
+        inserted = &table->entries[ index ];
+      }
+    }
+    // increment and wrap around at end
+    index = ( index + 1 ) & ( table->capacity - 1 );
+    distance++;
+  }
+  // place entry in empty slot
+  table->entries[ index ] = entry;
+  // return slot of new entry
+  return inserted ? inserted : &table->entries[ index ];
+}
 
-  // build hash
-  for ( size_t idx = 0; idx < len; idx++ ) {
-    hash += *byte++;
-    hash += ( hash << 10 );
-    hash ^= ( hash >> 6 );
+/**
+ * @brief Helper to remove an entry
+ *
+ * @param table
+ * @param entry
+ *
+ * @note following entries are shifted back to keep probe chains intact
+ */
+static void hashmap_remove_entry(
+  hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  // shift following entries back until empty or at home
+  size_t index = ( size_t )( entry - table->entries );
+  while ( true ) {
+    size_t next = ( index + 1 ) & ( table->capacity - 1 );
+    hashmap_entry_t* following = &table->entries[ next ];
+    if (
+      !following->key
+      || !hashmap_distance( following, next, table->capacity )
+    ) {
+      break;
+    }
+    table->entries[ index ] = *following;
+    index = next;
   }
-  hash += ( hash << 3 );
-  hash ^= ( hash >> 11 );
-  hash += ( hash << 15 );
+  // unset last shifted slot
+  memset( &table->entries[ index ], 0, sizeof( hashmap_entry_t ) );
+}
+
+/**
+ * @brief Helper to remove an entry of previous slots while migrating
+ *
+ * @param table
+ * @param entry
+ *
+ * @note entry stays in place to keep probe distances of previous slots, only
+ * the length is changed so that it never matches again
+ */
+static void hashmap_retire_entry(
+  __unused hashmap_table_t* table,
+  hashmap_entry_t* entry
+) {
+  entry->length = HASHMAP_RETIRED;
+  entry->value = NULL;
+}
 
-  // return built hash
-  return hash;
+/**
+ * @brief Helper to check whether a previous slot is still in use
+ *
+ * @param table
+ * @param index
+ * @return
+ */
+static bool hashmap_previous_live( hashmap_table_t* table, size_t index ) {
+  return table->old_entries[ index ].key
+    && HASHMAP_RETIRED != table->old_entries[ index ].length;
 }
 
 /**
- * @brief Helper to find an entry
+ * @brief Helper to allocate new empty slots
  *
- * @param entries
- * @param key
+ * @param table
  * @param capacity
  * @return
  */
-static hashmap_entry_t* hashmap_find_entry(
-  hashmap_entry_t* entries,
+static bool allocate_slots( hashmap_table_t* table, size_t capacity ) {
+  // allocate new hashmap entries
+  hashmap_entry_t* new_list = calloc( capacity, sizeof( hashmap_entry_t ) );
+  // handle error
+  if ( !new_list ) {
+    return false;
+  }
+  // set entries and new capacity
+  table->entries = new_list;
+  table->capacity = capacity;
+  // return success
+  return true;
+}
+#endif
+
+/**
+ * @brief Helper to migrate previous slots
+ *
+ * @param table
+ * @param count maximum amount of previous slots to migrate
+ *
+ * @note previous slots are released when everything has been migrated
+ */
+static void migrate( hashmap_table_t* table, size_t count ) {
+  // handle nothing to migrate
+  if ( !table->old_entries ) {
+    return;
+  }
+  // move live entries into current slots
+  while ( count-- && table->old_index < table->old_capacity ) {
+    size_t index = table->old_index++;
+    if ( hashmap_previous_live( table, index ) ) {
+      hashmap_insert_entry( table, table->old_entries[ index ] );
+      // retire moved one, so that it's never found within previous slots
+      hashmap_retire_entry( table, &table->old_entries[ index ] );
+    }
+  }
+  // release previous slots when done
+  if ( table->old_index >= table->old_capacity ) {
+    free( table->old_entries );
+    free( table->old_control );
+    table->old_entries = NULL;
+    table->old_control = NULL;
+    table->old_capacity = 0;
+    table->old_index = 0;
+  }
+}
+
+/**
+ * @brief Helper to find an entry within current and previous slots
+ *
+ * @param table
+ * @param key
+ * @param len
+ * @param hash
+ * @param old set to true if entry is within previous slots
+ * @return found entry or NULL
+ */
+static hashmap_entry_t* hashmap_lookup(
+  hashmap_table_t* table,
   const char* key,
-  size_t capacity
+  size_t len,
+  size_t hash,
+  bool* old
 ) {
-  // generate hash
-  size_t hash = hashmap_generate_hash( key );
-  size_t index = hash & ( capacity - 1 );
-  // loop until non empty
-  while ( entries[ index ].key ) {
-    // check if found and return
-    if ( !strcmp( key, entries[ index ].key ) ) {
-      return &entries[ index ];
-    }
-    // increment if key wasn't in slot and check for end reached
-    if ( ++index >= capacity ) {
-      index = 0;
-    }
+  // migrate a few previous slots
+  migrate( table, HASHMAP_MIGRATE_STEP );
+  // try current slots
+  *old = false;
+  hashmap_entry_t* e = hashmap_find_entry(
+    table->entries, table->control, table->capacity, key, len, hash );
+  if ( e || !table->old_entries ) {
+    return e;
   }
-  // return by index
-  return &entries[ index ];
+  // try previous slots, migrated ones are retired
+  e = hashmap_find_entry(
+    table->old_entries, table->old_control, table->old_capacity,
+    key, len, hash );
+  *old = NULL != e;
+  return e;
+}
+
+#if !defined( HASHMAP_COMPACT )
+/**
+ * @brief Helper to adjust hashmap size
+ *
+ * @param table
+ * @param capacity
+ * @return
+ *
+ * @note with incremental resize enabled, entries are migrated within the
+ * following operations instead of all at once
+ */
+static bool adjust_capacity( hashmap_table_t* table, size_t capacity ) {
+  // finish pending migration
+  migrate( table, SIZE_MAX );
+  // save old ones
+  hashmap_entry_t* old_list = table->entries;
+  uint8_t* old_control = table->control;
+  size_t old_capacity = table->capacity;
+  // allocate new slots
+  if ( !allocate_slots( table, capacity ) ) {
+    return false;
+  }
+  // set previous slots to be migrated
+  table->old_entries = old_list;
+  table->old_control = old_control;
+  table->old_capacity = old_capacity;
+  table->old_index = 0;
+  // migrate everything at once if not incremental
+  if ( !table->incremental ) {
+    migrate( table, SIZE_MAX );
+  }
+  // return success
+  return true;
+}
+#endif
+
+/**
+ * @brief Helper to get amount of slots within entries
+ *
+ * @param table
+ * @return
+ */
+static size_t slot_count( hashmap_table_t* table ) {
+#if defined( HASHMAP_COMPACT )
+  // only dense entries appended so far
+  return table->used;
+#else
+  return table->capacity;
+#endif
+}
+
+/**
+ * @brief Helper to check whether another entry would exceed maximum load
+ *
+ * @param table
+ * @return
+ */
+static bool hashmap_full( hashmap_table_t* table ) {
+#if defined( HASHMAP_COMPACT )
+  // dense entries are allocated up to maximum load
+  return table->used >= table->usable;
+#else
+  return ( table->length + table->deleted + 1 ) * 100
+    > table->capacity * table->max_load;
+#endif
 }
 
 /**
@@ -98,53 +1134,27 @@ static char* duplicate_key( const char* key, size_t len ) {
   if ( !tmp ) {
     return NULL;
   }
-  // clear out
-  memset( tmp, 0, sizeof( char ) * key_len );
-  // copy content
+  // copy content and terminate
   memcpy( tmp, key, sizeof( char ) * len );
+  tmp[ len ] = '\0';
   // return key
   return tmp;
 }
 
 /**
- * @brief Helper to adjust hashmap size
+ * @brief Helper to get capacity necessary for amount of entries
  *
  * @param table
- * @param capacity
+ * @param count
  * @return
  */
-static bool adjust_capacity( hashmap_table_t* table, size_t capacity ) {
-  // allocate new hashmap entries
-  hashmap_entry_t* new_list = calloc( capacity, sizeof( hashmap_entry_t ) );
-  // handle error
-  if ( !new_list ) {
-    return false;
+static size_t capacity_for( hashmap_table_t* table, size_t count ) {
+  size_t capacity = 0;
+  // enlarge until count fits within maximum load
+  while ( count * 100 > capacity * table->max_load ) {
+    capacity = HASHMAP_ENLARGE_CAPACITY( capacity );
   }
-  // clear out
-  memset( new_list, 0, sizeof( hashmap_entry_t ) * capacity );
-  // resize table length
-  table->length = 0;
-  for ( size_t i = 0; i < table->capacity; i++ ) {
-    // skip unused entries
-    if ( !table->entries[ i ].key ) {
-      continue;
-    }
-    // find entry
-    hashmap_entry_t* new_entry = hashmap_find_entry(
-      new_list, table->entries[ i ].key, capacity );
-    // copy over
-    new_entry->key = table->entries[ i ].key;
-    new_entry->value = table->entries[ i ].value;
-    // increment length
-    table->length++;
-  }
-  // free up old table
-  free( table->entries );
-  // set entries and new capacity
-  table->entries = new_list;
-  table->capacity = capacity;
-  // return success
-  return true;
+  return capacity;
 }
 
 /**
@@ -163,7 +1173,15 @@ hashmap_table_t* hashmap_construct( hashmap_entry_cleanup_t cleanup ) {
   // populate properties
   table->capacity = 0;
   table->length = 0;
+  table->max_load = HASHMAP_MAX_LOAD_FACTOR;
   table->entries = NULL;
+  table->control = NULL;
+  table->deleted = 0;
+  table->used = 0;
+  table->usable = 0;
+  table->old_entries = NULL;
+  table->old_control = NULL;
+  table->incremental = false;
   table->cleanup = cleanup ? cleanup : default_cleanup;
   // return built table
   return table;
@@ -176,7 +1194,7 @@ hashmap_table_t* hashmap_construct( hashmap_entry_cleanup_t cleanup ) {
  */
 void hashmap_destruct( hashmap_table_t* table ) {
   // loop through table items and free up keys
-  for ( size_t idx = 0; idx < table->capacity; idx++ ) {
+  for ( size_t idx = 0; idx < slot_count( table ); idx++ ) {
     // free key
     if ( table->entries[ idx ].key ) {
       free( ( void* )table->entries[ idx ].key );
@@ -186,10 +1204,24 @@ void hashmap_destruct( hashmap_table_t* table ) {
       table->cleanup( table->entries[ idx ].value );
     }
   }
+  // loop through not yet migrated previous items
+  for ( size_t idx = table->old_index; idx < table->old_capacity; idx++ ) {
+    if ( hashmap_previous_live( table, idx ) ) {
+      free( ( void* )table->old_entries[ idx ].key );
+      table->cleanup( table->old_entries[ idx ].value );
+    }
+  }
   // free table if set
   if ( table->entries ) {
     free( table->entries );
   }
+  // free control bytes if set
+  if ( table->control ) {
+    free( table->control );
+  }
+  // free previous slots
+  free( table->old_entries );
+  free( table->old_control );
   // free structure
   free( table );
 }
@@ -202,14 +1234,7 @@ void hashmap_destruct( hashmap_table_t* table ) {
  * @return Set value or NULL if not found
  */
 void* hashmap_value_get( hashmap_table_t* table, const char* key ) {
-  // handle no entries yet
-  if ( !table->entries ) {
-    return NULL;
-  }
-  // get matching entry from map
-  hashmap_entry_t* e = hashmap_find_entry( table->entries, key, table->capacity );
-  // return stored value ( NULL if not set previously )
-  return e->value;
+  return hashmap_value_get_n( table, key, strlen( key ) );
 }
 
 /**
@@ -221,21 +1246,29 @@ void* hashmap_value_get( hashmap_table_t* table, const char* key ) {
  * @return Set value or NULL if not found
  */
 void* hashmap_value_get_n( hashmap_table_t* table, const char* key, size_t len ) {
-  // handle no entries yet
-  if ( !table->entries ) {
-    return NULL;
-  }
-  // duplicate key
-  char* tmp = duplicate_key( key, len );
-  if ( !tmp ) {
-    return NULL;
-  }
-  // get value using temporary key
-  void* data = hashmap_value_get( table, tmp );
-  // free up temporary
-  free( tmp );
-  // return found data
-  return data;
+  return hashmap_value_get_hashed( table, key, len, hashmap_hash( key, len ) );
+}
+
+/**
+ * @brief Method to get hashmap entry by key with given size and hash
+ *
+ * @param table
+ * @param key
+ * @param len
+ * @param hash hash of key previously generated by hashmap_hash
+ * @return Set value or NULL if not found
+ */
+void* hashmap_value_get_hashed(
+  hashmap_table_t* table,
+  const char* key,
+  size_t len,
+  size_t hash
+) {
+  bool old;
+  // get matching entry from map
+  hashmap_entry_t* e = hashmap_lookup( table, key, len, hash, &old );
+  // return stored value ( NULL if not set previously )
+  return e ? e->value : NULL;
 }
 
 /**
@@ -251,35 +1284,7 @@ const char* hashmap_value_set(
   const char* key,
   void* value
 ) {
-  // expand table if limit reached
-  if (
-    table->length + 1 >= table->capacity
-    && !adjust_capacity(
-      table,
-      HASHMAP_ENLARGE_CAPACITY( table->capacity )
-    ) ) {
-    return NULL;
-  }
-  // get matching entry from map
-  hashmap_entry_t* e = hashmap_find_entry( table->entries, key, table->capacity );
-  if ( e->key ) {
-    // handle no new key
-    table->cleanup( e->value );
-    e->value = value;
-  } else {
-    // handle new key ( duplicate key )
-    char* new_key = duplicate_key( key, strlen( key ) );
-    if ( !new_key ) {
-      return NULL;
-    }
-    // push back data
-    e->key = new_key;
-    e->value = value;
-    // increase length
-    table->length++;
-  }
-  // return stored key ( NULL if not set previously )
-  return e->key;
+  return hashmap_value_set_n( table, key, value, strlen( key ) );
 }
 
 /**
@@ -297,17 +1302,63 @@ const char* hashmap_value_set_n(
   void* value,
   size_t len
 ) {
-  // duplicate key
-  char* tmp = duplicate_key( key, len );
-  if ( !tmp ) {
+  return hashmap_value_set_hashed(
+    table, key, value, len, hashmap_hash( key, len ) );
+}
+
+/**
+ * @brief Set a value in hashmap with already generated hash
+ *
+ * @param table
+ * @param key
+ * @param value
+ * @param len
+ * @param hash hash of key previously generated by hashmap_hash
+ * @return
+ */
+const char* hashmap_value_set_hashed(
+  hashmap_table_t* table,
+  const char* key,
+  void* value,
+  size_t len,
+  size_t hash
+) {
+  bool old;
+  // get matching entry from map
+  hashmap_entry_t* e = hashmap_lookup( table, key, len, hash, &old );
+  if ( e ) {
+    // handle no new key
+    table->cleanup( e->value );
+    e->value = value;
+    return e->key;
+  }
+  // expand table or drop deleted slots if maximum load would be exceeded
+  if ( hashmap_full( table ) ) {
+    size_t capacity = capacity_for( table, table->length + 1 );
+    if ( !adjust_capacity(
+      table,
+      capacity < table->capacity ? table->capacity : capacity
+    ) ) {
+      return NULL;
+    }
+  }
+  // handle new key ( duplicate key )
+  char* new_key = duplicate_key( key, len );
+  if ( !new_key ) {
     return NULL;
   }
-  // add via normal set
-  const char* return_key = hashmap_value_set( table, tmp, value );
-  // free temporary ( duplicated in hashmap value set )
-  free( tmp );
-  // return set key
-  return return_key;
+  // insert entry
+  hashmap_entry_t entry = {
+    .key = new_key,
+    .length = len,
+    .hash = hash,
+    .value = value,
+  };
+  e = hashmap_insert_entry( table, entry );
+  // increase length
+  table->length++;
+  // return stored key
+  return e->key;
 }
 
 /**
@@ -318,52 +1369,141 @@ const char* hashmap_value_set_n(
  * @return
  */
 bool hashmap_value_del( hashmap_table_t* table, const char* key ) {
+  return hashmap_value_del_n( table, key, strlen( key ) );
+}
+
+/**
+ * @brief Delete a value by key
+ *
+ * @param table
+ * @param key
+ * @param len
+ */
+bool hashmap_value_del_n( hashmap_table_t* table, const char* key, size_t len ) {
+  bool old;
   // find entry
-  hashmap_entry_t* e = hashmap_find_entry( table->entries, key, table->capacity );
+  hashmap_entry_t* e = hashmap_lookup(
+    table, key, len, hashmap_hash( key, len ), &old );
   // treat no key ( no entry ) as failure
-  if ( !e->key ) {
+  if ( !e ) {
     return false;
   }
   // cleanup value
   table->cleanup( e->value );
   // free key
-  free( e->key );
-  // unset key and value to NULL again
-  e->key = NULL;
-  e->value = NULL;
+  free( ( void* )e->key );
+  // remove entry from table
+  if ( old ) {
+    hashmap_retire_entry( table, e );
+  } else {
+    hashmap_remove_entry( table, e );
+  }
+  // decrease length
+  table->length--;
   // return success
   return true;
 }
 
 /**
- * @brief Delete a value by key
+ * @brief Method to get hashmap length
  *
  * @param table
- * @param key
- * @param len
+ * @return length of the hashmap
  */
-bool hashmap_value_del_n( hashmap_table_t* table, const char* key, size_t len ) {
-  // duplicate key
-  char* tmp = duplicate_key( key, len );
-  if ( !tmp ) {
+size_t hashmap_length( hashmap_table_t* table ) {
+  return table->length;
+}
+
+/**
+ * @brief Set maximum load factor in percent
+ *
+ * @param table
+ * @param max_load
+ * @return
+ *
+ * @note table is enlarged if current length exceeds the new load factor
+ */
+bool hashmap_max_load_factor( hashmap_table_t* table, size_t max_load ) {
+  // handle invalid load factor, at least one slot has to be empty
+  if ( !max_load || 100 <= max_load ) {
+    return false;
+  }
+  // set load factor
+  table->max_load = max_load;
+#if defined( HASHMAP_COMPACT )
+  // dense entries are allocated up to maximum load
+  if ( table->capacity && !adjust_usable( table ) ) {
     return false;
   }
-  // delete value
-  bool r = hashmap_value_del( table, tmp );
-  // free tmp again
-  free( tmp );
-  // return result
-  return r;
+#endif
+  // enlarge if necessary
+  return hashmap_reserve( table, table->length );
 }
 
 /**
- * @brief Method to get hashmap length
+ * @brief Enable or disable incremental resize
  *
  * @param table
- * @return length of the hashmap
+ * @param incremental
+ *
+ * @note pending migration is finished when disabled, compact layout is
+ * always resized at once to keep insertion order
  */
-size_t hashmap_length( hashmap_table_t* table ) {
-  return table->length;
+void hashmap_incremental_resize( hashmap_table_t* table, bool incremental ) {
+  table->incremental = incremental;
+  // finish pending migration
+  if ( !incremental ) {
+    migrate( table, SIZE_MAX );
+  }
+}
+
+/**
+ * @brief Reserve space for amount of entries without further resize
+ *
+ * @param table
+ * @param count
+ * @return
+ */
+bool hashmap_reserve( hashmap_table_t* table, size_t count ) {
+  // get necessary capacity
+  size_t capacity = capacity_for( table, count );
+  // nothing to do if big enough
+  if ( capacity <= table->capacity ) {
+    return true;
+  }
+  // resize
+  return adjust_capacity( table, capacity );
+}
+
+/**
+ * @brief Shrink capacity to smallest one fitting current length
+ *
+ * @param table
+ * @return
+ */
+bool hashmap_shrink( hashmap_table_t* table ) {
+  // finish pending migration
+  migrate( table, SIZE_MAX );
+  // get necessary capacity
+  size_t capacity = capacity_for( table, table->length );
+  // nothing to do if not smaller
+  if ( capacity >= table->capacity ) {
+    return true;
+  }
+  // release everything if empty
+  if ( !capacity ) {
+    free( table->entries );
+    free( table->control );
+    table->entries = NULL;
+    table->control = NULL;
+    table->capacity = 0;
+    table->deleted = 0;
+    table->used = 0;
+    table->usable = 0;
+    return true;
+  }
+  // resize
+  return adjust_capacity( table, capacity );
 }
 
 /**
@@ -387,23 +1527,38 @@ hashmap_iterator_t hashmap_iterator( hashmap_table_t* table ) {
  *
  * @param iterator
  * @return
+ *
+ * @note entries not yet migrated are returned after the current ones, with
+ * compact layout entries are returned in insertion order
  */
 bool hashmap_next( hashmap_iterator_t* iterator ) {
+  hashmap_table_t* table = iterator->table;
+  size_t count = slot_count( table );
   // loop while there is still something left
-  while ( iterator->index < iterator->table->capacity ) {
+  while ( iterator->index < count ) {
     // save current index
     size_t index = iterator->index;
     // increment to next one
     iterator->index++;
     // handle something in current index
-    if ( iterator->table->entries[ index ].key ) {
+    if ( table->entries[ index ].key ) {
       // save key and value in iterator
-      iterator->key = iterator->table->entries[ index ].key;
-      iterator->value = iterator->table->entries[ index ].value;
+      iterator->key = table->entries[ index ].key;
+      iterator->value = table->entries[ index ].value;
       // return success
       return true;
     }
   }
+  // loop through previous slots not yet migrated
+  while ( iterator->index - count < table->old_capacity ) {
+    size_t index = iterator->index - count;
+    iterator->index++;
+    if ( hashmap_previous_live( table, index ) ) {
+      iterator->key = table->old_entries[ index ].key;
+      iterator->value = table->old_entries[ index ].value;
+      return true;
+    }
+  }
   // return end
   return false;
 }
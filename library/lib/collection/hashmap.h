@@ -17,13 +17,20 @@
  * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#if !defined( HASHMAP_H )
+#define HASHMAP_H
+
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define HASHMAP_ENLARGE_CAPACITY( c ) ( ( c ) < 8 ? 8 : ( c ) * 2 )
-
-#if !defined( HASHMAP_H )
-#define HASHMAP_H
+// default maximum load factor in percent
+#define HASHMAP_MAX_LOAD_FACTOR 75
+// amount of previous slots migrated per operation with incremental resize
+#define HASHMAP_MIGRATE_STEP 16
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,13 +45,29 @@ typedef void ( * hashmap_entry_cleanup_t )( void* a );
 
 struct hashmap_entry {
   const char* key;
+  size_t length;
+  size_t hash;
   void* value;
 };
 
 struct hashmap_table {
   hashmap_entry_t* entries;
+  // control bytes with group probing or slot index with compact layout
+  uint8_t* control;
+  // deleted slots, only used with group probing
+  size_t deleted;
   size_t capacity;
   size_t length;
+  size_t max_load;
+  // used and allocated dense entries, only used with compact layout
+  size_t used;
+  size_t usable;
+  // previous slots not yet migrated with incremental resize
+  hashmap_entry_t* old_entries;
+  uint8_t* old_control;
+  size_t old_capacity;
+  size_t old_index;
+  bool incremental;
   hashmap_entry_cleanup_t cleanup;
 };
 
@@ -61,14 +84,189 @@ hashmap_table_t* hashmap_construct( hashmap_entry_cleanup_t );
 void hashmap_destruct( hashmap_table_t* );
 void* hashmap_value_get( hashmap_table_t*, const char* );
 void* hashmap_value_get_n( hashmap_table_t*, const char*, size_t );
+void* hashmap_value_get_hashed( hashmap_table_t*, const char*, size_t, size_t );
 const char* hashmap_value_set( hashmap_table_t*, const char*, void* );
 const char* hashmap_value_set_n( hashmap_table_t*, const char*, void*, size_t );
+const char* hashmap_value_set_hashed(
+  hashmap_table_t*, const char*, void*, size_t, size_t );
 bool hashmap_value_del( hashmap_table_t*, const char* );
 bool hashmap_value_del_n( hashmap_table_t*, const char*, size_t );
 size_t hashmap_length( hashmap_table_t* );
+size_t hashmap_hash( const char*, size_t );
+bool hashmap_max_load_factor( hashmap_table_t*, size_t );
+void hashmap_incremental_resize( hashmap_table_t*, bool );
+bool hashmap_reserve( hashmap_table_t*, size_t );
+bool hashmap_shrink( hashmap_table_t* );
 hashmap_iterator_t hashmap_iterator( hashmap_table_t* );
 bool hashmap_next( hashmap_iterator_t* );
 
+/**
+ * @brief Define a hashmap storing values of given type inline
+ *
+ * @param name prefix of generated types and functions
+ * @param type type of values
+ *
+ * @note generated table uses linear probing with the same hash and load
+ * factor as hashmap_table_t, keys are duplicated and values are copied
+ */
+#define HASHMAP_DEFINE( name, type ) \
+  typedef struct name##_entry { \
+    const char* key; \
+    size_t length; \
+    size_t hash; \
+    type value; \
+  } name##_entry_t; \
+  \
+  typedef struct name { \
+    name##_entry_t* entries; \
+    size_t capacity; \
+    size_t length; \
+  } name##_t; \
+  \
+  static inline void name##_init( name##_t* table ) { \
+    memset( table, 0, sizeof( *table ) ); \
+  } \
+  \
+  static inline void name##_free( name##_t* table ) { \
+    for ( size_t index = 0; index < table->capacity; index++ ) { \
+      free( ( void* )table->entries[ index ].key ); \
+    } \
+    free( table->entries ); \
+    memset( table, 0, sizeof( *table ) ); \
+  } \
+  \
+  static inline name##_entry_t* name##_slot( \
+    name##_t* table, \
+    const char* key, \
+    size_t len, \
+    size_t hash \
+  ) { \
+    size_t mask = table->capacity - 1; \
+    size_t index = hash & mask; \
+    /* loop until matching or empty slot */ \
+    while ( table->entries[ index ].key && !( \
+      hash == table->entries[ index ].hash \
+      && len == table->entries[ index ].length \
+      && !memcmp( key, table->entries[ index ].key, len ) \
+    ) ) { \
+      index = ( index + 1 ) & mask; \
+    } \
+    return &table->entries[ index ]; \
+  } \
+  \
+  static inline type* name##_get( \
+    name##_t* table, \
+    const char* key, \
+    size_t len \
+  ) { \
+    if ( !table->capacity ) { \
+      return NULL; \
+    } \
+    name##_entry_t* entry = name##_slot( \
+      table, key, len, hashmap_hash( key, len ) ); \
+    return entry->key ? &entry->value : NULL; \
+  } \
+  \
+  static inline bool name##_resize( name##_t* table, size_t capacity ) { \
+    name##_t resized = { \
+      .entries = calloc( capacity, sizeof( name##_entry_t ) ), \
+      .capacity = capacity, \
+      .length = table->length, \
+    }; \
+    if ( !resized.entries ) { \
+      return false; \
+    } \
+    /* move entries into new slots */ \
+    for ( size_t index = 0; index < table->capacity; index++ ) { \
+      name##_entry_t* entry = &table->entries[ index ]; \
+      if ( entry->key ) { \
+        *name##_slot( &resized, entry->key, entry->length, entry->hash ) = \
+          *entry; \
+      } \
+    } \
+    free( table->entries ); \
+    *table = resized; \
+    return true; \
+  } \
+  \
+  static inline bool name##_set( \
+    name##_t* table, \
+    const char* key, \
+    size_t len, \
+    type value \
+  ) { \
+    /* enlarge if maximum load would be exceeded */ \
+    if ( \
+      ( table->length + 1 ) * 100 > table->capacity * HASHMAP_MAX_LOAD_FACTOR \
+      && !name##_resize( table, HASHMAP_ENLARGE_CAPACITY( table->capacity ) ) \
+    ) { \
+      return false; \
+    } \
+    size_t hash = hashmap_hash( key, len ); \
+    name##_entry_t* entry = name##_slot( table, key, len, hash ); \
+    /* duplicate key of new entries */ \
+    if ( !entry->key ) { \
+      char* copy = malloc( len + 1 ); \
+      if ( !copy ) { \
+        return false; \
+      } \
+      memcpy( copy, key, len ); \
+      copy[ len ] = '\0'; \
+      entry->key = copy; \
+      entry->length = len; \
+      entry->hash = hash; \
+      table->length++; \
+    } \
+    entry->value = value; \
+    return true; \
+  } \
+  \
+  static inline bool name##_del( \
+    name##_t* table, \
+    const char* key, \
+    size_t len \
+  ) { \
+    if ( !table->capacity ) { \
+      return false; \
+    } \
+    name##_entry_t* entry = name##_slot( \
+      table, key, len, hashmap_hash( key, len ) ); \
+    if ( !entry->key ) { \
+      return false; \
+    } \
+    free( ( void* )entry->key ); \
+    size_t mask = table->capacity - 1; \
+    size_t hole = ( size_t )( entry - table->entries ); \
+    /* shift back following entries whose home isn't behind the hole */ \
+    for ( \
+      size_t index = ( hole + 1 ) & mask; \
+      table->entries[ index ].key; \
+      index = ( index + 1 ) & mask \
+    ) { \
+      size_t home = table->entries[ index ].hash & mask; \
+      if ( ( ( index - home ) & mask ) >= ( ( index - hole ) & mask ) ) { \
+        table->entries[ hole ] = table->entries[ index ]; \
+        hole = index; \
+      } \
+    } \
+    memset( &table->entries[ hole ], 0, sizeof( name##_entry_t ) ); \
+    table->length--; \
+    return true; \
+  } \
+  \
+  static inline name##_entry_t* name##_next( \
+    name##_t* table, \
+    size_t* index \
+  ) { \
+    while ( *index < table->capacity ) { \
+      name##_entry_t* entry = &table->entries[ ( *index )++ ]; \
+      if ( entry->key ) { \
+        return entry; \
+      } \
+    } \
+    return NULL; \
+  }
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "list.h"
+#include "pool.h"
 
 /**
  * @brief Default lookup if not passed during creation
@@ -43,7 +44,7 @@ int32_t list_default_lookup(
  */
 void list_default_cleanup( list_item_t* a ) {
   // free current element
-  free( a );
+  pool_free( a, sizeof( list_item_t ) );
 }
 
 /**
@@ -71,7 +72,7 @@ list_manager_t* list_construct(
   list_insert_func_t insert
 ) {
   // allocate list
-  list_manager_t* list = malloc( sizeof( list_manager_t ) );
+  list_manager_t* list = pool_allocate( sizeof( list_manager_t ) );
   // handle error
   if ( !list ) {
     return NULL;
@@ -134,7 +135,7 @@ void list_destruct( list_manager_t* list ) {
   }
 
   // finally, free list
-  free( list );
+  pool_free( list, sizeof( list_manager_t ) );
 }
 
 /**
@@ -228,8 +229,8 @@ list_item_t* list_lookup_item( list_manager_t* list, const list_item_t* item ) {
  */
 list_item_t* list_item_create( void* data ) {
   // allocate new node
-  list_item_t* node = malloc( sizeof( list_item_t ) );
-  // check malloc result
+  list_item_t* node = pool_allocate( sizeof( list_item_t ) );
+  // check allocation result
   if ( !node ) {
     return NULL;
   }
@@ -331,7 +332,7 @@ void* list_pop_front_data( list_manager_t* list ) {
   }
 
   // free first element
-  free( first );
+  pool_free( first, sizeof( list_item_t ) );
   // return set data
   return data;
 }
@@ -374,7 +375,7 @@ void* list_pop_back_data( list_manager_t* list ) {
   }
 
   // free first element
-  free( last );
+  pool_free( last, sizeof( list_item_t ) );
   // return set data
   return data;
 }
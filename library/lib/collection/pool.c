@@ -0,0 +1,222 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "pool.h"
+
+// macro to round up to a multiple
+#define POOL_ROUND_UP( v, m ) ( ( ( v ) + ( m ) - 1 ) / ( m ) * ( m ) )
+// aligned size of slab header
+#define POOL_SLAB_HEADER POOL_ROUND_UP( sizeof( pool_slab_t ), POOL_ALIGNMENT )
+
+// size class pools, set up on first use
+static pool_t size_class[ POOL_SIZE_CLASS_COUNT ];
+
+/**
+ * @brief Setup pool structure for items of given size
+ *
+ * @param pool
+ * @param size
+ */
+void pool_setup( pool_t* pool, size_t size ) {
+  // clear out
+  memset( pool, 0, sizeof( pool_t ) );
+  // item has to be able to hold a free list entry
+  if ( size < sizeof( pool_free_t ) ) {
+    size = sizeof( pool_free_t );
+  }
+  // keep every item aligned
+  pool->size = POOL_ROUND_UP( size, POOL_ALIGNMENT );
+  // determine amount of items per slab
+  pool->slab_item = ( POOL_SLAB_SIZE - POOL_SLAB_HEADER ) / pool->size;
+  if ( !pool->slab_item ) {
+    pool->slab_item = 1;
+  }
+}
+
+/**
+ * @brief Construct pool for items of given size
+ *
+ * @param size
+ * @return
+ */
+pool_t* pool_construct( size_t size ) {
+  // allocate pool
+  pool_t* pool = malloc( sizeof( pool_t ) );
+  if ( !pool ) {
+    return NULL;
+  }
+  // setup pool
+  pool_setup( pool, size );
+  // return pool
+  return pool;
+}
+
+/**
+ * @brief Release all slabs of a pool
+ *
+ * @param pool
+ *
+ * @note all items of the pool are invalid afterwards
+ */
+void pool_clear( pool_t* pool ) {
+  // handle invalid
+  if ( !pool ) {
+    return;
+  }
+  // free slabs
+  pool_slab_t* slab = pool->slab;
+  while ( slab ) {
+    pool_slab_t* next = slab->next;
+    free( slab );
+    slab = next;
+  }
+  // reset slab, free list and bump pointer
+  pool->slab = NULL;
+  pool->free = NULL;
+  pool->bump = NULL;
+  pool->end = NULL;
+}
+
+/**
+ * @brief Destruct pool
+ *
+ * @param pool
+ */
+void pool_destruct( pool_t* pool ) {
+  // handle invalid
+  if ( !pool ) {
+    return;
+  }
+  // release slabs
+  pool_clear( pool );
+  // free pool
+  free( pool );
+}
+
+/**
+ * @brief Allocate an item from pool
+ *
+ * @param pool
+ * @return
+ */
+void* pool_item_allocate( pool_t* pool ) {
+  // reuse released item if existing
+  if ( pool->free ) {
+    pool_free_t* item = pool->free;
+    pool->free = item->next;
+    pool->hit++;
+    return item;
+  }
+  // allocate new slab if current one is exhausted
+  if ( pool->bump >= pool->end ) {
+    pool_slab_t* slab = malloc(
+      POOL_SLAB_HEADER + pool->size * pool->slab_item );
+    if ( !slab ) {
+      return NULL;
+    }
+    // link slab
+    slab->next = pool->slab;
+    pool->slab = slab;
+    // set bump range
+    pool->bump = ( uint8_t* )slab + POOL_SLAB_HEADER;
+    pool->end = pool->bump + pool->size * pool->slab_item;
+    pool->miss++;
+  } else {
+    pool->hit++;
+  }
+  // bump pointer
+  void* item = pool->bump;
+  pool->bump += pool->size;
+  // return item
+  return item;
+}
+
+/**
+ * @brief Release item back to pool
+ *
+ * @param pool
+ * @param item
+ */
+void pool_item_free( pool_t* pool, void* item ) {
+  // handle invalid
+  if ( !item ) {
+    return;
+  }
+  // push to free list
+  pool_free_t* entry = item;
+  entry->next = pool->free;
+  pool->free = entry;
+}
+
+/**
+ * @brief Get size class pool for size
+ *
+ * @param size
+ * @return pool or NULL if size is not served by a size class
+ */
+pool_t* pool_size_class( size_t size ) {
+  // handle not served by size classes
+  if ( !size || POOL_SIZE_CLASS_MAX < size ) {
+    return NULL;
+  }
+  // get pool
+  size_t index = ( size - 1 ) / POOL_SIZE_CLASS_STEP;
+  pool_t* pool = &size_class[ index ];
+  // setup pool on first use
+  if ( !pool->size ) {
+    pool_setup( pool, ( index + 1 ) * POOL_SIZE_CLASS_STEP );
+  }
+  // return pool
+  return pool;
+}
+
+/**
+ * @brief Allocate memory from size class pool or heap for large sizes
+ *
+ * @param size
+ * @return
+ */
+void* pool_allocate( size_t size ) {
+  pool_t* pool = pool_size_class( size );
+  // fallback to heap
+  if ( !pool ) {
+    return malloc( size );
+  }
+  // allocate from pool
+  return pool_item_allocate( pool );
+}
+
+/**
+ * @brief Free memory allocated via pool_allocate
+ *
+ * @param data
+ * @param size size passed during allocation
+ */
+void pool_free( void* data, size_t size ) {
+  pool_t* pool = pool_size_class( size );
+  // fallback to heap
+  if ( !pool ) {
+    free( data );
+    return;
+  }
+  // release to pool
+  pool_item_free( pool, data );
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined( POOL_H )
+#define POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// alignment of pool items, sufficient for every fundamental type
+#define POOL_ALIGNMENT _Alignof( max_align_t )
+// amount of memory requested per slab
+#define POOL_SLAB_SIZE 4096
+// size class granularity and amount of size classes
+#define POOL_SIZE_CLASS_STEP 16
+#define POOL_SIZE_CLASS_COUNT 16
+// maximum size served by size classes
+#define POOL_SIZE_CLASS_MAX ( POOL_SIZE_CLASS_STEP * POOL_SIZE_CLASS_COUNT )
+
+// forward declaration
+typedef struct pool_slab pool_slab_t;
+typedef struct pool_free pool_free_t;
+typedef struct pool pool_t;
+
+// slab header, items follow aligned
+struct pool_slab {
+  pool_slab_t* next;
+};
+
+// free list entry placed within released items
+struct pool_free {
+  pool_free_t* next;
+};
+
+struct pool {
+  size_t size;
+  size_t slab_item;
+  pool_slab_t* slab;
+  pool_free_t* free;
+  uint8_t* bump;
+  uint8_t* end;
+  size_t hit;
+  size_t miss;
+};
+
+pool_t* pool_construct( size_t );
+void pool_destruct( pool_t* );
+void pool_setup( pool_t*, size_t );
+void pool_clear( pool_t* );
+void* pool_item_allocate( pool_t* );
+void pool_item_free( pool_t*, void* );
+
+pool_t* pool_size_class( size_t );
+void* pool_allocate( size_t );
+void pool_free( void*, size_t );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
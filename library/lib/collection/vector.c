@@ -0,0 +1,241 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "vector.h"
+#include "pool.h"
+
+/**
+ * @brief Default cleanup if not passed during creation
+ *
+ * @param a
+ */
+void vector_default_cleanup( __unused void* a ) {}
+
+/**
+ * @brief Method to construct vector
+ *
+ * @param cleanup called per item on destruct
+ * @return vector_t* pointer to created vector
+ */
+vector_t* vector_construct( vector_cleanup_func_t cleanup ) {
+  // allocate vector
+  vector_t* vector = pool_allocate( sizeof( vector_t ) );
+  // handle error
+  if ( !vector ) {
+    return NULL;
+  }
+  // overwrite with zero
+  memset( ( void* )vector, 0, sizeof( vector_t ) );
+  // start with inline data
+  vector->data = vector->inline_data;
+  vector->size = 0;
+  vector->capacity = VECTOR_INLINE_CAPACITY;
+  // cleanup function
+  if ( cleanup ) {
+    vector->cleanup = cleanup;
+  } else {
+    vector->cleanup = vector_default_cleanup;
+  }
+  // return created vector
+  return vector;
+}
+
+/**
+ * @brief Method to construct vector within an arena
+ *
+ * @param arena arena providing vector and storage
+ * @return vector_t* pointer to created vector
+ *
+ * @note vector and its storage are released together with the arena
+ */
+vector_t* vector_construct_arena( arena_t* arena ) {
+  // allocate vector
+  vector_t* vector = arena_allocate( arena, sizeof( vector_t ) );
+  // handle error
+  if ( !vector ) {
+    return NULL;
+  }
+  // overwrite with zero
+  memset( ( void* )vector, 0, sizeof( vector_t ) );
+  // start with inline data
+  vector->data = vector->inline_data;
+  vector->size = 0;
+  vector->capacity = VECTOR_INLINE_CAPACITY;
+  vector->cleanup = vector_default_cleanup;
+  vector->arena = arena;
+  // return created vector
+  return vector;
+}
+
+/**
+ * @brief Method to destruct vector
+ *
+ * @param vector vector to use
+ */
+void vector_destruct( vector_t* vector ) {
+  // check parameter
+  if ( !vector ) {
+    return;
+  }
+  // cleanup items
+  for ( size_t index = 0; index < vector->size; index++ ) {
+    vector->cleanup( vector->data[ index ] );
+  }
+  // storage and vector belong to arena
+  if ( vector->arena ) {
+    return;
+  }
+  // free heap storage
+  if ( vector->data != vector->inline_data ) {
+    free( vector->data );
+  }
+  // finally, free vector
+  pool_free( vector, sizeof( vector_t ) );
+}
+
+/**
+ * @brief Reserve space for amount of items
+ *
+ * @param vector
+ * @param capacity
+ * @return
+ */
+bool vector_reserve( vector_t* vector, size_t capacity ) {
+  // nothing to do if big enough
+  if ( capacity <= vector->capacity ) {
+    return true;
+  }
+  // arena storage is never enlarged in place
+  if ( vector->arena ) {
+    void** data = arena_allocate( vector->arena, sizeof( void* ) * capacity );
+    if ( !data ) {
+      return false;
+    }
+    // copy over, previous storage is released with the arena
+    memcpy( data, vector->data, sizeof( void* ) * vector->size );
+    vector->data = data;
+    vector->capacity = capacity;
+    return true;
+  }
+  // allocate heap storage or enlarge it
+  void** data = vector->data == vector->inline_data
+    ? malloc( sizeof( void* ) * capacity )
+    : realloc( vector->data, sizeof( void* ) * capacity );
+  if ( !data ) {
+    return false;
+  }
+  // move inline data
+  if ( vector->data == vector->inline_data ) {
+    memcpy( data, vector->inline_data, sizeof( void* ) * vector->size );
+  }
+  // set new storage
+  vector->data = data;
+  vector->capacity = capacity;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Push data to the end of the vector
+ *
+ * @param vector
+ * @param data
+ * @return
+ */
+bool vector_push_back( vector_t* vector, void* data ) {
+  // enlarge if full
+  if (
+    vector->size >= vector->capacity
+    && !vector_reserve( vector, VECTOR_ENLARGE_CAPACITY( vector->capacity ) )
+  ) {
+    return false;
+  }
+  // push back
+  vector->data[ vector->size++ ] = data;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Pop data from the end of the vector
+ *
+ * @param vector
+ * @return popped data or NULL if empty
+ */
+void* vector_pop_back( vector_t* vector ) {
+  // handle empty
+  if ( !vector->size ) {
+    return NULL;
+  }
+  // return last one
+  return vector->data[ --vector->size ];
+}
+
+/**
+ * @brief Get data at index
+ *
+ * @param vector
+ * @param index
+ * @return data or NULL if out of range
+ */
+void* vector_at( vector_t* vector, size_t index ) {
+  // handle out of range
+  if ( index >= vector->size ) {
+    return NULL;
+  }
+  // return data
+  return vector->data[ index ];
+}
+
+/**
+ * @brief Get last data
+ *
+ * @param vector
+ * @return data or NULL if empty
+ */
+void* vector_back( vector_t* vector ) {
+  // handle empty
+  if ( !vector->size ) {
+    return NULL;
+  }
+  // return last one
+  return vector->data[ vector->size - 1 ];
+}
+
+/**
+ * @brief Get amount of items
+ *
+ * @param vector
+ * @return
+ */
+size_t vector_size( vector_t* vector ) {
+  return vector->size;
+}
+
+/**
+ * @brief Method checks for vector is empty
+ *
+ * @param vector
+ * @return
+ */
+bool vector_empty( vector_t* vector ) {
+  return !vector->size;
+}
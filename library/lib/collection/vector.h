@@ -0,0 +1,142 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "arena.h"
+#else
+  #include <bosl/collection/arena.h>
+#endif
+
+#if !defined( VECTOR_H )
+#define VECTOR_H
+
+// amount of items stored inline before heap storage is used
+#define VECTOR_INLINE_CAPACITY 4
+#define VECTOR_ENLARGE_CAPACITY( c ) ( ( c ) * 2 )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// forward declaration
+typedef struct vector vector_t;
+
+typedef void ( * vector_cleanup_func_t )( void* data );
+
+struct vector {
+  void** data; // points either to inline data or heap storage
+  size_t size;
+  size_t capacity;
+  vector_cleanup_func_t cleanup;
+  arena_t* arena; // owning arena or NULL if heap allocated
+  void* inline_data[ VECTOR_INLINE_CAPACITY ];
+};
+
+void vector_default_cleanup( void* );
+vector_t* vector_construct( vector_cleanup_func_t );
+vector_t* vector_construct_arena( arena_t* );
+void vector_destruct( vector_t* );
+bool vector_reserve( vector_t*, size_t );
+bool vector_push_back( vector_t*, void* );
+void* vector_pop_back( vector_t* );
+void* vector_at( vector_t*, size_t );
+void* vector_back( vector_t* );
+size_t vector_size( vector_t* );
+bool vector_empty( vector_t* );
+
+/**
+ * @brief Define a vector storing values of given type inline
+ *
+ * @param name prefix of generated type and functions
+ * @param type type of values
+ *
+ * @note generated vector points into itself until grown, so it mustn't be
+ * copied after values have been pushed
+ */
+#define VECTOR_DEFINE( name, type ) \
+  typedef struct name { \
+    type* data; \
+    size_t size; \
+    size_t capacity; \
+    type inline_data[ VECTOR_INLINE_CAPACITY ]; \
+  } name##_t; \
+  \
+  static inline void name##_init( name##_t* vector ) { \
+    vector->data = vector->inline_data; \
+    vector->size = 0; \
+    vector->capacity = VECTOR_INLINE_CAPACITY; \
+  } \
+  \
+  static inline void name##_free( name##_t* vector ) { \
+    if ( vector->data != vector->inline_data ) { \
+      free( vector->data ); \
+    } \
+    name##_init( vector ); \
+  } \
+  \
+  static inline bool name##_reserve( name##_t* vector, size_t capacity ) { \
+    if ( capacity <= vector->capacity ) { \
+      return true; \
+    } \
+    bool heap = vector->data != vector->inline_data; \
+    type* data = realloc( heap ? vector->data : NULL, \
+      sizeof( type ) * capacity ); \
+    if ( !data ) { \
+      return false; \
+    } \
+    /* move inline values */ \
+    if ( !heap ) { \
+      memcpy( data, vector->inline_data, sizeof( type ) * vector->size ); \
+    } \
+    vector->data = data; \
+    vector->capacity = capacity; \
+    return true; \
+  } \
+  \
+  static inline bool name##_push_back( name##_t* vector, type value ) { \
+    if ( \
+      vector->size >= vector->capacity \
+      && !name##_reserve( \
+        vector, VECTOR_ENLARGE_CAPACITY( vector->capacity ) ) \
+    ) { \
+      return false; \
+    } \
+    vector->data[ vector->size++ ] = value; \
+    return true; \
+  } \
+  \
+  static inline type* name##_at( name##_t* vector, size_t index ) { \
+    return index < vector->size ? &vector->data[ index ] : NULL; \
+  } \
+  \
+  static inline size_t name##_size( name##_t* vector ) { \
+    return vector->size; \
+  }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,599 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ast/common.h"
+#include "ast/expression.h"
+#include "ast/statement.h"
+#include "compiler.h"
+#include "object.h"
+#include "value.h"
+#include "error.h"
+
+// necessary forward declarations
+static bool compile_expression( bosl_ast_expression_t* );
+static bool compile_statement( bosl_ast_statement_t* );
+
+static bosl_compiler_t* compiler = NULL;
+
+/**
+ * @brief Helper to emit an opcode
+ *
+ * @param opcode
+ * @return
+ */
+static bool emit_opcode( bosl_opcode_t opcode ) {
+  if ( !bosl_chunk_write( compiler->chunk, ( uint8_t )opcode ) ) {
+    bosl_error_raise( NULL, "Unable to write opcode to chunk." );
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to emit an operand
+ *
+ * @param operand
+ * @return
+ */
+static bool emit_operand( uint32_t operand ) {
+  if ( !bosl_chunk_write_operand( compiler->chunk, operand ) ) {
+    bosl_error_raise( NULL, "Unable to write operand to chunk." );
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to emit a token operand
+ *
+ * @param token
+ * @return
+ */
+static bool emit_token( bosl_token_t* token ) {
+  uint32_t index;
+  // push token to chunk
+  if ( !bosl_chunk_push_token( compiler->chunk, token, &index ) ) {
+    bosl_error_raise( token, "Unable to push token to chunk." );
+    return false;
+  }
+  // emit index
+  return emit_operand( index );
+}
+
+/**
+ * @brief Helper to emit a constant
+ *
+ * @param value
+ * @return
+ */
+static bool emit_constant( bosl_value_t* value ) {
+  uint32_t index;
+  // push constant to chunk
+  if ( !bosl_chunk_push_constant( compiler->chunk, value, &index ) ) {
+    bosl_value_release( value );
+    bosl_error_raise( NULL, "Unable to push constant to chunk." );
+    return false;
+  }
+  // emit instruction
+  return emit_opcode( BOSL_OPCODE_CONSTANT ) && emit_operand( index );
+}
+
+/**
+ * @brief Helper to emit null constant
+ *
+ * @return
+ */
+static bool emit_null( void ) {
+  bosl_value_t value = {
+    .value_type = BOSL_OBJECT_VALUE_NULL,
+    .type = BOSL_OBJECT_TYPE_UNDEFINED,
+  };
+  return emit_constant( &value );
+}
+
+/**
+ * @brief Helper to get current offset as jump target
+ *
+ * @param target
+ * @return
+ */
+static bool current_target( uint32_t* target ) {
+  // handle too large chunk
+  if ( UINT32_MAX < compiler->chunk->count ) {
+    bosl_error_raise( NULL, "Chunk exceeds maximum jump distance." );
+    return false;
+  }
+  *target = ( uint32_t )compiler->chunk->count;
+  return true;
+}
+
+/**
+ * @brief Helper to emit a jump with placeholder target
+ *
+ * @param opcode
+ * @param offset
+ * @return
+ */
+static bool emit_jump( bosl_opcode_t opcode, size_t* offset ) {
+  // emit opcode
+  if ( !emit_opcode( opcode ) ) {
+    return false;
+  }
+  // save offset of operand
+  *offset = compiler->chunk->count;
+  // emit placeholder
+  return emit_operand( UINT32_MAX );
+}
+
+/**
+ * @brief Helper to patch a jump to current offset
+ *
+ * @param offset
+ * @return
+ */
+static bool patch_jump( size_t offset ) {
+  uint32_t target;
+  // get current target
+  if ( !current_target( &target ) ) {
+    return false;
+  }
+  // patch operand
+  bosl_chunk_patch_operand( compiler->chunk, offset, target );
+  return true;
+}
+
+/**
+ * @brief Helper to emit scope pops
+ *
+ * @param amount
+ * @return
+ */
+static bool emit_scope_pop( size_t amount ) {
+  while ( amount-- ) {
+    if ( !emit_opcode( BOSL_OPCODE_SCOPE_POP ) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to add a loop exit operand which is patched at the end of the loop
+ *
+ * @param loop
+ * @param offset
+ * @return
+ */
+static bool loop_exit_push( bosl_compiler_loop_t* loop, size_t offset ) {
+  // push offset
+  if ( !bosl_compiler_exit_push_back( &loop->exit, offset ) ) {
+    bosl_error_raise( NULL, "Unable to enlarge loop exit list." );
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Compile logical expression with short circuit
+ *
+ * @param l
+ * @return
+ */
+static bool compile_logical( bosl_ast_expression_logical_t* l ) {
+  size_t end;
+  // compile left side
+  if ( !compile_expression( l->left ) ) {
+    return false;
+  }
+  // emit short circuit jump
+  if ( !emit_jump(
+    TOKEN_OR_OR == l->operator->type ? BOSL_OPCODE_OR : BOSL_OPCODE_AND,
+    &end
+  ) ) {
+    return false;
+  }
+  // compile right side and patch jump
+  return compile_expression( l->right ) && patch_jump( end );
+}
+
+/**
+ * @brief Compile call expression
+ *
+ * @param c
+ * @return
+ */
+static bool compile_call( bosl_ast_expression_call_t* c ) {
+  // compile callee
+  if ( !compile_expression( c->callee ) ) {
+    return false;
+  }
+  // compile arguments
+  uint32_t count = 0;
+  for ( ; count < vector_size( c->arguments ); count++ ) {
+    if ( !compile_expression( vector_at( c->arguments, count ) ) ) {
+      return false;
+    }
+  }
+  // emit call
+  return emit_opcode( BOSL_OPCODE_CALL )
+    && emit_operand( count )
+    && emit_token( c->paren );
+}
+
+/**
+ * @brief Compile an expression
+ *
+ * @param e
+ * @return
+ */
+static bool compile_expression( bosl_ast_expression_t* e ) {
+  switch ( e->type ) {
+    case EXPRESSION_ASSIGN:
+      return compile_expression( e->assign->value )
+        && emit_opcode( BOSL_OPCODE_ASSIGN )
+        && emit_operand( ( uint32_t )e->assign->depth )
+        && emit_operand( ( uint32_t )e->assign->slot )
+        && emit_token( e->assign->token );
+    case EXPRESSION_BINARY:
+      return compile_expression( e->binary->left )
+        && compile_expression( e->binary->right )
+        && emit_opcode( BOSL_OPCODE_BINARY )
+        && emit_token( e->binary->operator );
+    case EXPRESSION_CALL:
+      return compile_call( e->call );
+    case EXPRESSION_GROUPING:
+      return compile_expression( e->grouping->expression );
+    case EXPRESSION_LITERAL: {
+      bosl_value_t value;
+      if ( !bosl_value_from_literal( e->literal, &value ) ) {
+        bosl_error_raise( NULL, "Unsupported object type in literal." );
+        return false;
+      }
+      return emit_constant( &value );
+    }
+    case EXPRESSION_LOGICAL:
+      return compile_logical( e->logical );
+    case EXPRESSION_UNARY:
+      return compile_expression( e->unary->right )
+        && emit_opcode( BOSL_OPCODE_UNARY )
+        && emit_token( e->unary->operator );
+    case EXPRESSION_VARIABLE:
+      return emit_opcode( BOSL_OPCODE_GET_VARIABLE )
+        && emit_operand( ( uint32_t )e->variable->depth )
+        && emit_operand( ( uint32_t )e->variable->slot )
+        && emit_token( e->variable->name );
+    case EXPRESSION_LOAD:
+    case EXPRESSION_POINTER:
+      break;
+  }
+  bosl_error_raise( NULL, "Unknown expression." );
+  return false;
+}
+
+/**
+ * @brief Compile while loop
+ *
+ * @param w
+ * @return
+ */
+static bool compile_while( bosl_ast_statement_while_t* w ) {
+  // setup loop
+  bosl_compiler_loop_t loop;
+  memset( &loop, 0, sizeof( loop ) );
+  loop.enclosing = compiler->loop;
+  loop.start = compiler->chunk->count;
+  loop.scope = compiler->scope;
+  bosl_compiler_exit_init( &loop.exit );
+  // compile condition and exit jump
+  size_t exit;
+  if (
+    !compile_expression( w->condition )
+    || !emit_jump( BOSL_OPCODE_JUMP_IF_FALSE, &exit )
+    || !loop_exit_push( &loop, exit )
+  ) {
+    bosl_compiler_exit_free( &loop.exit );
+    return false;
+  }
+  // compile body with loop set
+  compiler->loop = &loop;
+  bool result = compile_statement( w->body )
+    && emit_opcode( BOSL_OPCODE_JUMP )
+    && emit_operand( ( uint32_t )loop.start );
+  compiler->loop = loop.enclosing;
+  // patch all exits
+  for (
+    size_t index = 0;
+    result && index < bosl_compiler_exit_size( &loop.exit );
+    index++
+  ) {
+    result = patch_jump( *bosl_compiler_exit_at( &loop.exit, index ) );
+  }
+  // free exit list and return result
+  bosl_compiler_exit_free( &loop.exit );
+  return result;
+}
+
+/**
+ * @brief Compile break and continue
+ *
+ * @param b
+ * @param is_break
+ * @return
+ */
+static bool compile_break_continue(
+  bosl_ast_statement_break_continue_t* b,
+  bool is_break
+) {
+  // count loops
+  uint32_t count = 0;
+  for ( bosl_compiler_loop_t* l = compiler->loop; l; l = l->enclosing ) {
+    count++;
+  }
+  // handle no loop
+  if ( !count ) {
+    bosl_error_raise(
+      b->token, is_break ? "Break outside of loop." : "Continue outside of loop." );
+    return false;
+  }
+  // level resolved by parser results in a direct jump
+  size_t level = b->resolved_level;
+  if ( 0 < level && count >= level ) {
+    bosl_compiler_loop_t* loop = compiler->loop;
+    while ( --level ) {
+      loop = loop->enclosing;
+    }
+    // leave scopes
+    if ( !emit_scope_pop( compiler->scope - loop->scope ) ) {
+      return false;
+    }
+    // continue just jumps back to start
+    if ( !is_break ) {
+      return emit_opcode( BOSL_OPCODE_JUMP )
+        && emit_operand( ( uint32_t )loop->start );
+    }
+    // break jumps to the end, which is patched later
+    size_t exit;
+    return emit_jump( BOSL_OPCODE_JUMP, &exit ) && loop_exit_push( loop, exit );
+  }
+  // evaluate level at runtime
+  if (
+    !compile_expression( b->level )
+    || !emit_opcode( is_break ? BOSL_OPCODE_BREAK : BOSL_OPCODE_CONTINUE )
+    || !emit_token( b->token )
+    || !emit_operand( count )
+  ) {
+    return false;
+  }
+  // emit jump table
+  for ( bosl_compiler_loop_t* l = compiler->loop; l; l = l->enclosing ) {
+    if ( is_break ) {
+      if ( !loop_exit_push( l, compiler->chunk->count ) ) {
+        return false;
+      }
+    }
+    if (
+      !emit_operand( is_break ? UINT32_MAX : ( uint32_t )l->start )
+      || !emit_operand( ( uint32_t )( compiler->scope - l->scope ) )
+    ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Compile function
+ *
+ * @param f
+ * @return
+ */
+static bool compile_function( bosl_ast_statement_function_t* f ) {
+  uint32_t index;
+  // push function to chunk
+  if ( !bosl_chunk_push_function( compiler->chunk, f, &index ) ) {
+    bosl_error_raise( f->token, "Unable to push function to chunk." );
+    return false;
+  }
+  // emit function creation
+  if ( !emit_opcode( BOSL_OPCODE_FUNCTION ) || !emit_operand( index ) ) {
+    return false;
+  }
+  // load functions have no body
+  if ( !f->body ) {
+    return true;
+  }
+  // jump over function body
+  size_t over;
+  if ( !emit_jump( BOSL_OPCODE_JUMP, &over ) ) {
+    return false;
+  }
+  // save entry
+  compiler->chunk->function[ index ].entry = compiler->chunk->count;
+  // backup loop and scope
+  bosl_compiler_loop_t* loop = compiler->loop;
+  size_t scope = compiler->scope;
+  compiler->loop = NULL;
+  compiler->scope = 0;
+  // compile body with implicit return at the end
+  bool result = compile_statement( f->body )
+    && emit_opcode( BOSL_OPCODE_RETURN_NOTHING );
+  // restore loop and scope
+  compiler->loop = loop;
+  compiler->scope = scope;
+  // patch jump over
+  return result && patch_jump( over );
+}
+
+/**
+ * @brief Compile if statement
+ *
+ * @param i
+ * @return
+ */
+static bool compile_if( bosl_ast_statement_if_t* i ) {
+  size_t else_jump;
+  // compile condition and if branch
+  if (
+    !compile_expression( i->if_condition )
+    || !emit_jump( BOSL_OPCODE_JUMP_IF_FALSE, &else_jump )
+    || !compile_statement( i->if_statement )
+  ) {
+    return false;
+  }
+  // without else just patch jump
+  if ( !i->else_statement ) {
+    return patch_jump( else_jump );
+  }
+  // jump over else branch
+  size_t end_jump;
+  return emit_jump( BOSL_OPCODE_JUMP, &end_jump )
+    && patch_jump( else_jump )
+    && compile_statement( i->else_statement )
+    && patch_jump( end_jump );
+}
+
+/**
+ * @brief Compile a statement
+ *
+ * @param s
+ * @return
+ */
+static bool compile_statement( bosl_ast_statement_t* s ) {
+  switch ( s->type ) {
+    case STATEMENT_BLOCK: {
+      // open scope
+      if (
+        !emit_opcode( BOSL_OPCODE_SCOPE_PUSH )
+        || !emit_operand( ( uint32_t )s->block->slot_count )
+      ) {
+        return false;
+      }
+      compiler->scope++;
+      // compile statement per statement
+      vector_t* statements = s->block->statements;
+      for ( size_t index = 0; index < vector_size( statements ); index++ ) {
+        if ( !compile_statement( vector_at( statements, index ) ) ) {
+          return false;
+        }
+      }
+      // close scope
+      compiler->scope--;
+      return emit_opcode( BOSL_OPCODE_SCOPE_POP );
+    }
+    case STATEMENT_EXPRESSION:
+      return compile_expression( s->expression->expression )
+        && emit_opcode( BOSL_OPCODE_POP );
+    case STATEMENT_PARAMETER:
+      bosl_error_raise(
+        s->parameter->name,
+        "Parameter statement is standalone not possible."
+      );
+      return false;
+    case STATEMENT_FUNCTION:
+      return compile_function( s->function );
+    case STATEMENT_IF:
+      return compile_if( s->if_else );
+    case STATEMENT_PRINT:
+      return compile_expression( s->print->expression )
+        && emit_opcode( BOSL_OPCODE_PRINT );
+    case STATEMENT_RETURN:
+      return (
+        s->return_value->value
+          ? compile_expression( s->return_value->value )
+          : emit_null()
+      ) && emit_opcode( BOSL_OPCODE_RETURN );
+    case STATEMENT_VARIABLE:
+      return (
+        s->variable->initializer
+          ? compile_expression( s->variable->initializer )
+          : emit_null()
+      ) && emit_opcode( BOSL_OPCODE_DEFINE_VARIABLE )
+        && emit_operand( ( uint32_t )s->variable->slot )
+        && emit_token( s->variable->name )
+        && emit_token( s->variable->type );
+    case STATEMENT_CONST:
+      return compile_expression( s->constant->initializer )
+        && emit_opcode( BOSL_OPCODE_DEFINE_CONSTANT )
+        && emit_operand( ( uint32_t )s->constant->slot )
+        && emit_token( s->constant->name )
+        && emit_token( s->constant->type );
+    case STATEMENT_WHILE:
+      return compile_while( s->while_loop );
+    case STATEMENT_BREAK:
+      return compile_break_continue( s->break_continue, true );
+    case STATEMENT_CONTINUE:
+      return compile_break_continue( s->break_continue, false );
+    case STATEMENT_POINTER:
+      bosl_error_raise( s->pointer->name, "Not implemented statement" );
+      return false;
+  }
+  bosl_error_raise( NULL, "Unknown ast statement" );
+  return false;
+}
+
+/**
+ * @brief Compile ast to bytecode chunk
+ *
+ * @param ast
+ * @return
+ */
+bosl_chunk_t* bosl_compiler_compile( vector_t* ast ) {
+  // allocate compiler structure
+  compiler = malloc( sizeof( bosl_compiler_t ) );
+  if ( !compiler ) {
+    return NULL;
+  }
+  // clear out
+  memset( compiler, 0, sizeof( bosl_compiler_t ) );
+  // allocate chunk
+  compiler->chunk = bosl_chunk_allocate();
+  if ( !compiler->chunk ) {
+    free( compiler );
+    compiler = NULL;
+    return NULL;
+  }
+  // compile node per node
+  bool result = true;
+  for ( size_t index = 0; result && index < vector_size( ast ); index++ ) {
+    bosl_ast_node_t* node = vector_at( ast, index );
+    // handle no statement
+    if ( !node->statement ) {
+      bosl_error_raise( NULL, "Invalid ast node" );
+      result = false;
+      break;
+    }
+    // compile statement
+    result = compile_statement( node->statement );
+  }
+  // finish with halt
+  result = result && emit_opcode( BOSL_OPCODE_HALT );
+  // get chunk and free compiler
+  bosl_chunk_t* chunk = compiler->chunk;
+  free( compiler );
+  compiler = NULL;
+  // handle error
+  if ( !result ) {
+    bosl_chunk_destroy( chunk );
+    return NULL;
+  }
+  // return chunk
+  return chunk;
+}
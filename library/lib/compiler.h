@@ -0,0 +1,61 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "collection/vector.h"
+  #include "bytecode/chunk.h"
+#else
+  #include <bosl/collection/vector.h>
+  #include <bosl/bytecode/chunk.h>
+#endif
+
+#if !defined( BOSL_COMPILER_H )
+#define BOSL_COMPILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+VECTOR_DEFINE( bosl_compiler_exit, size_t )
+
+typedef struct bosl_compiler_loop bosl_compiler_loop_t;
+
+typedef struct bosl_compiler_loop {
+  bosl_compiler_loop_t* enclosing;
+  size_t start;
+  size_t scope;
+  bosl_compiler_exit_t exit;
+} bosl_compiler_loop_t;
+
+typedef struct {
+  bosl_chunk_t* chunk;
+  bosl_compiler_loop_t* loop;
+  size_t scope;
+} bosl_compiler_t;
+
+bosl_chunk_t* bosl_compiler_compile( vector_t* );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,40 +20,69 @@
 #include <stdlib.h>
 #include <string.h>
 #include "environment.h"
-#include "collection/hashmap.h"
 #include "scanner.h"
 #include "error.h"
 
 /**
- * @brief Environment hashmap cleanup helper
+ * @brief Initialize execution environment
  *
- * @param object
+ * @param enclosing
+ * @param slot_count
+ * @return
  */
-static void environment_cleanup( void* object ) {
-  bosl_object_destroy( object );
+bosl_environment_t* bosl_environment_init(
+  bosl_environment_t* enclosing,
+  size_t slot_count
+) {
+  // calculate size including slots
+  size_t size = sizeof( bosl_environment_t )
+    + sizeof( bosl_object_t* ) * slot_count;
+  // allocate environment structure
+  bosl_environment_t* environment = malloc( size );
+  if ( !environment ) {
+    return NULL;
+  }
+  // clear out
+  memset( environment, 0, size );
+  // set enclosing and slot count
+  environment->enclosing = enclosing;
+  environment->slot_count = slot_count;
+  // return success
+  return environment;
 }
 
 /**
- * @brief Initialize execution environment
+ * @brief Initialize execution environment within an arena
  *
+ * @param arena
+ * @param enclosing
+ * @param slot_count
  * @return
+ *
+ * @note environments of an arena have to be freed in reverse order
  */
-bosl_environment_t* bosl_environment_init( bosl_environment_t* enclosing ) {
+bosl_environment_t* bosl_environment_init_arena(
+  arena_t* arena,
+  bosl_environment_t* enclosing,
+  size_t slot_count
+) {
+  // calculate size including slots
+  size_t size = sizeof( bosl_environment_t )
+    + sizeof( bosl_object_t* ) * slot_count;
+  // remember arena position for release
+  arena_mark_t mark = arena_mark( arena );
   // allocate environment structure
-  bosl_environment_t* environment = malloc( sizeof( bosl_environment_t ) );
+  bosl_environment_t* environment = arena_allocate( arena, size );
   if ( !environment ) {
     return NULL;
   }
   // clear out
-  memset( environment, 0, sizeof( bosl_environment_t ) );
-  // setup hashmap
-  environment->value = hashmap_construct( environment_cleanup );
-  if ( !environment->value ) {
-    free( environment );
-    return NULL;
-  }
-  // set enclosing
+  memset( environment, 0, size );
+  // set enclosing, arena and slot count
   environment->enclosing = enclosing;
+  environment->arena = arena;
+  environment->mark = mark;
+  environment->slot_count = slot_count;
   // return success
   return environment;
 }
@@ -68,64 +97,90 @@ void bosl_environment_free( bosl_environment_t* environment ) {
   if ( !environment ) {
     return;
   }
-  // destroy hashmap
-  hashmap_destruct( environment->value );
+  // destroy values
+  for ( size_t index = 0; index < environment->slot_count; index++ ) {
+    bosl_object_destroy( environment->slot[ index ] );
+  }
+  // reset arena if allocated from one
+  if ( environment->arena ) {
+    arena_reset( environment->arena, environment->mark );
+    return;
+  }
   // destroy object
   free( environment );
 }
 
 /**
- * @brief Push value to environment
+ * @brief Push value to environment slot
  *
  * @param environment
- * @param token
+ * @param slot
  * @param object
  * @return
  */
 bool bosl_environment_push_value(
   bosl_environment_t* environment,
-  bosl_token_t* token,
+  size_t slot,
   bosl_object_t* object
 ) {
-  // add to hashmap
-  const char* r = hashmap_value_set_n(
-    environment->value,
-    token->start,
-    object,
-    token->length
-  );
-  // set environment member
-  if ( r ) {
-    object->environment = true;
+  // handle invalid slot
+  if ( slot >= environment->slot_count ) {
+    return false;
+  }
+  // destroy previous value
+  if ( environment->slot[ slot ] && environment->slot[ slot ] != object ) {
+    bosl_object_destroy( environment->slot[ slot ] );
   }
-  // return
-  return r;
+  // set value and environment member
+  environment->slot[ slot ] = object;
+  object->environment = true;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to get environment by depth
+ *
+ * @param environment
+ * @param depth
+ * @return
+ */
+static bosl_environment_t* environment_at(
+  bosl_environment_t* environment,
+  size_t depth
+) {
+  // handle unresolved
+  if ( BOSL_ENVIRONMENT_UNRESOLVED == depth ) {
+    return NULL;
+  }
+  // walk up enclosing environments
+  while ( environment && depth-- ) {
+    environment = environment->enclosing;
+  }
+  // return environment
+  return environment;
 }
 
 /**
  * @brief Get variable from environment
  *
  * @param environment
+ * @param depth
+ * @param slot
  * @param token
  * @return
  */
 bosl_object_t* bosl_environment_get_value(
   bosl_environment_t* environment,
+  size_t depth,
+  size_t slot,
   bosl_token_t* token
 ) {
-  // try to get value
-  bosl_object_t* value = hashmap_value_get_n(
-    environment->value,
-    token->start,
-    token->length
-  );
+  // get environment
+  environment = environment_at( environment, depth );
   // return if something is there
-  if ( value ) {
-    return value;
-  }
-  // try enclosing if set
-  if ( environment->enclosing ) {
-    return bosl_environment_get_value( environment->enclosing, token );
+  if ( environment && slot < environment->slot_count && environment->slot[ slot ] ) {
+    return environment->slot[ slot ];
   }
   // handle not found
   bosl_error_raise( token, "Undefined variable." );
@@ -136,22 +191,24 @@ bosl_object_t* bosl_environment_get_value(
  * @brief Assign a value
  *
  * @param environment
+ * @param depth
+ * @param slot
  * @param token
  * @param object
  * @return
  */
 bool bosl_environment_assign_value(
   bosl_environment_t* environment,
+  size_t depth,
+  size_t slot,
   bosl_token_t* token,
   bosl_object_t* object
 ) {
-  // try current level
-  if ( hashmap_value_get_n( environment->value, token->start, token->length ) ) {
-    return bosl_environment_push_value( environment, token, object );
-  }
-  // try enclosing
-  if ( environment->enclosing ) {
-    return bosl_environment_assign_value( environment->enclosing, token, object );
+  // get environment
+  environment = environment_at( environment, depth );
+  // assign if variable exists
+  if ( environment && slot < environment->slot_count && environment->slot[ slot ] ) {
+    return bosl_environment_push_value( environment, slot, object );
   }
   // raise error and return false
   bosl_error_raise( token, "Undefined variable." );
@@ -17,16 +17,18 @@
  * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/hashmap.h"
   #include "scanner.h"
   #include "object.h"
+  #include "collection/arena.h"
 #else
-  #include <bosl/collection/hashmap.h>
   #include <bosl/scanner.h>
   #include <bosl/object.h>
+  #include <bosl/collection/arena.h>
 #endif
 
 #if !defined( BOSL_ENVIRONMENT_H )
@@ -36,18 +38,28 @@
 extern "C" {
 #endif
 
+// depth of references which couldn't be resolved statically
+#define BOSL_ENVIRONMENT_UNRESOLVED SIZE_MAX
+
 typedef struct bosl_environment bosl_environment_t;
 
 typedef struct bosl_environment {
-  hashmap_table_t* value;
   bosl_environment_t* enclosing;
+  arena_t* arena;
+  arena_mark_t mark;
+  size_t slot_count;
+  bosl_object_t* slot[];
 } bosl_environment_t;
 
-bosl_environment_t* bosl_environment_init( bosl_environment_t* );
+bosl_environment_t* bosl_environment_init( bosl_environment_t*, size_t );
+bosl_environment_t* bosl_environment_init_arena(
+  arena_t*, bosl_environment_t*, size_t );
 void bosl_environment_free( bosl_environment_t* );
-bool bosl_environment_push_value( bosl_environment_t*, bosl_token_t*, bosl_object_t* );
-bosl_object_t* bosl_environment_get_value( bosl_environment_t*, bosl_token_t* );
-bool bosl_environment_assign_value( bosl_environment_t*, bosl_token_t*, bosl_object_t* );
+bool bosl_environment_push_value( bosl_environment_t*, size_t, bosl_object_t* );
+bosl_object_t* bosl_environment_get_value(
+  bosl_environment_t*, size_t, size_t, bosl_token_t* );
+bool bosl_environment_assign_value(
+  bosl_environment_t*, size_t, size_t, bosl_token_t*, bosl_object_t* );
 
 #ifdef __cplusplus
 }
@@ -28,11 +28,19 @@
 #include "error.h"
 #include "environment.h"
 #include "object.h"
+#include "value.h"
 #include "binding.h"
+#include "compiler.h"
+#include "vm.h"
+#include "resolver.h"
+
+// amount of arguments passed without allocation
+#define INTERPRETER_INLINE_ARGUMENT 8
 
 // necessary forward declarations
-static bosl_object_t* evaluate_expression( bosl_ast_expression_t* );
-static bosl_object_t* execute_function( bosl_object_t*, list_manager_t* );
+static bool evaluate_expression( bosl_ast_expression_t*, bosl_value_t* );
+static bool call_function(
+  bosl_object_t*, bosl_value_t*, size_t, bosl_value_t* );
 
 static bosl_interpreter_t* interpreter = NULL;
 
@@ -42,18 +50,12 @@ static bosl_interpreter_t* interpreter = NULL;
  * @return
  */
 static bosl_ast_statement_t* previous( void ) {
-  // handle no current
-  if ( !interpreter->current_item ) {
-    return NULL;
-  }
-  // get previous item
-  list_item_t* item = interpreter->current_item->previous;
   // handle no previous
-  if ( !item ) {
+  if ( !interpreter->current_index ) {
     return NULL;
   }
   // return statement
-  return ( bosl_ast_statement_t* )item->data;
+  return vector_at( interpreter->ast, interpreter->current_index - 1 );
 }
 
 /**
@@ -62,12 +64,8 @@ static bosl_ast_statement_t* previous( void ) {
  * @return
  */
 static bosl_ast_statement_t* current( void ) {
-  // handle no current
-  if ( !interpreter->current_item ) {
-    return NULL;
-  }
-  // return current statement
-  return ( bosl_ast_statement_t* )( interpreter->current_item->data );
+  // return current statement or null if beyond
+  return vector_at( interpreter->ast, interpreter->current_index );
 }
 
 /**
@@ -76,8 +74,8 @@ static bosl_ast_statement_t* current( void ) {
  * @return
  */
 static bosl_ast_statement_t* next( void ) {
-  if ( interpreter->current_item->next ) {
-    interpreter->current_item = interpreter->current_item->next;
+  if ( interpreter->current_index + 1 < vector_size( interpreter->ast ) ) {
+    interpreter->current_index++;
   }
   return interpreter->previous();
 }
@@ -105,916 +103,381 @@ static void destroy_object( bosl_object_t* object ) {
  *
  * @param item
  */
-static void object_list_cleanup( list_item_t* item ) {
-  if ( !item ) {
-    return;
-  }
-  if ( !item->data ) {
-    return;
-  }
-  destroy_object( item->data );
-  list_default_cleanup( item );
+static void object_list_cleanup( void* item ) {
+  destroy_object( item );
 }
 
 /**
- * @brief Helper to check whether object is truthy value
+ * @brief Helper to release a range of argument values
  *
- * @param object
- * @return
- *
- * @todo Treat values ( int, uint, float ) as true if not 0
+ * @param argument
+ * @param from
+ * @param to
  */
-static bosl_object_t* object_truthy(
-  bosl_object_t* object,
-  bool negotiate
+static void release_argument(
+  bosl_value_t* argument,
+  size_t from,
+  size_t to
 ) {
-  // handle invalid
-  if ( !object || !object->data ) {
-    bosl_interpreter_emit_error( NULL, "Broken object passed to truthy." );
-    return NULL;
+  for ( size_t index = from; index < to; index++ ) {
+    bosl_value_release( &argument[ index ] );
   }
-  bool flag = true;
-  if ( BOSL_OBJECT_VALUE_NULL == object->value_type ) {
-    // handle null
-    flag = false;
-  } else if ( BOSL_OBJECT_VALUE_BOOL == object->value_type ) {
-    // evaluate boolean
-    flag = *( ( bool* )( object->data ) );
-  }
-  // handle negotiation
-  if ( negotiate ) {
-    flag = !flag;
-  }
-  // build and return object
-  return bosl_object_allocate(
-    BOSL_OBJECT_VALUE_BOOL,
-    BOSL_OBJECT_TYPE_BOOL,
-    &flag,
-    sizeof( flag )
-  );
 }
 
 /**
- * @brief Helper to check whether two objects are equal
- *
- * @param left
- * @param right
- * @param negotiate
- * @return
+ * @brief Helper to free argument space if taken from arena
  *
- * @todo Add change depending on type
- * @todo float and integer comparison shall be not equal
- * @todo integer and unsigned integer shall be equal when both values are comparable and equal
+ * @param argument
+ * @param inline_argument
+ * @param mark
  */
-static bosl_object_t* object_equal(
-  bosl_object_t* left,
-  bosl_object_t* right,
-  bool negotiate
+static void free_argument(
+  bosl_value_t* argument,
+  bosl_value_t* inline_argument,
+  arena_mark_t mark
 ) {
-  // handle invalid
-  if ( !left || !left->data || !right || !right->data ) {
-    bosl_interpreter_emit_error( NULL, "Broken objects passed to truthy." );
-    return NULL;
+  if ( argument != inline_argument ) {
+    arena_reset( interpreter->arena, mark );
   }
-  bool flag = false;
-  if (
-    BOSL_OBJECT_VALUE_NULL == left->value_type
-    && BOSL_OBJECT_VALUE_NULL == right->value_type ) {
-    // handle both null
-    flag = true;
-  } else if ( left->value_type == right->value_type ) {
-    // handle comparison
-    if ( BOSL_OBJECT_VALUE_BOOL == left->value_type ) {
-      flag = *( ( bool* )( left->data ) ) == *( ( bool* )( right->data ) );
-    } else {
-      flag = 0 == memcmp(
-        left->data,
-        right->data,
-        right->size > left->size ? left->size : right->size
-      );
-    }
-  }
-  // handle negotiation
-  if ( negotiate ) {
-    flag = !flag;
-  }
-  // return result
-  return bosl_object_allocate(
-    BOSL_OBJECT_VALUE_BOOL,
-    BOSL_OBJECT_TYPE_BOOL,
-    &flag,
-    sizeof( flag )
-  );
 }
 
 /**
  * @brief Helper to evaluate binary
  *
  * @param b
+ * @param value
  * @return
- *
- * @todo add type checking when performing addition, subtraction, division or multiplication
- * @todo raise error for <, <=, >, >= when types are not comparable, e.g. integer and double
  */
-static bosl_object_t* evaluate_binary( bosl_ast_expression_binary_t* b ) {
+static bool evaluate_binary(
+  bosl_ast_expression_binary_t* b,
+  bosl_value_t* value
+) {
   // evaluate left
-  bosl_object_t* left = evaluate_expression( b->left );
-  if ( !left ) {
+  bosl_value_t left;
+  if ( !evaluate_expression( b->left, &left ) ) {
     bosl_interpreter_emit_error( b->operator, "Unable to evaluate left expression" );
-    return NULL;
+    return false;
   }
   // evaluate right
-  bosl_object_t* right = evaluate_expression( b->right );
-  if ( !right ) {
+  bosl_value_t right;
+  if ( !evaluate_expression( b->right, &right ) ) {
     bosl_interpreter_emit_error( b->operator, "Unable to evaluate right expression" );
-    destroy_object( left );
-    return NULL;
-  }
-  // flag indicating different types
-  bool same_type = left->value_type == right->value_type;
-  // enforce same type and number
-  if (
-    TOKEN_BANG_EQUAL != b->operator->type
-    && TOKEN_EQUAL_EQUAL != b->operator->type
-    && !same_type ) {
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == left->value_type ) {
-      // change right if left is signed
-      right->value_type = left->value_type;
-      same_type = true;
-    } else if ( BOSL_OBJECT_VALUE_INT_SIGNED == right->value_type ) {
-      // change left if right is signed
-      left->value_type = right->value_type;
-      same_type = true;
-    } else {
-      bosl_interpreter_emit_error( b->operator, "Different types for binary." );
-      destroy_object( left );
-      destroy_object( right );
-      return NULL;
-    }
-  }
-  // variables for values
-  int64_t left_signed_number = 0;
-  uint64_t left_unsigned_number = 0;
-  long double left_float_number = 0;
-  int64_t right_signed_number = 0;
-  uint64_t right_unsigned_number = 0;
-  long double right_float_number = 0;
-  // extract stuff
-  if (
-    b->operator->type != TOKEN_EQUAL_EQUAL
-    && b->operator->type != TOKEN_BANG_EQUAL
-    && b->operator->type != TOKEN_BANG
-    && (
-      !bosl_object_extract_number( left, &left_unsigned_number, &left_signed_number, &left_float_number )
-      || !bosl_object_extract_number( right, &right_unsigned_number, &right_signed_number, &right_float_number )
-    ) ) {
-    bosl_interpreter_emit_error( b->operator, "Number extraction failed." );
-    destroy_object( left );
-    destroy_object( right );
-    return NULL;
+    bosl_value_release( &left );
+    return false;
   }
-
   // apply operator
-  if ( TOKEN_MINUS == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      long double result = left_float_number - right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_FLOAT,
-        BOSL_OBJECT_TYPE_FLOAT,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      uint64_t result = left_unsigned_number - right_unsigned_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_UINT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      int64_t result = left_signed_number - right_signed_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_INT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_PLUS == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      long double result = left_float_number + right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_FLOAT,
-        BOSL_OBJECT_TYPE_FLOAT,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      uint64_t result = left_unsigned_number + right_unsigned_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_UINT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      int64_t result = left_signed_number + right_signed_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_INT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_SLASH == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      long double result = left_float_number / right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_FLOAT,
-        BOSL_OBJECT_TYPE_FLOAT,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      uint64_t result = left_unsigned_number / right_unsigned_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_UINT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      int64_t result = left_signed_number / right_signed_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_INT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_STAR == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      long double result = left_float_number * right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_FLOAT,
-        BOSL_OBJECT_TYPE_FLOAT,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      uint64_t result = left_unsigned_number * right_unsigned_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_UINT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      int64_t result = left_signed_number * right_signed_number;
-      return bosl_object_allocate(
-        type,
-        BOSL_OBJECT_TYPE_INT_64,
-        &result,
-        sizeof( result )
-      );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_GREATER == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      bool result = left_float_number > right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      bool result = left_unsigned_number > right_unsigned_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      bool result = left_signed_number > right_signed_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_GREATER_EQUAL == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      bool result = left_float_number >= right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      bool result = left_unsigned_number >= right_unsigned_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      bool result = left_signed_number >= right_signed_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_LESS == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      bool result = left_float_number < right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      bool result = left_unsigned_number < right_unsigned_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      bool result = left_signed_number < right_signed_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_LESS_EQUAL == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t type = left->value_type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle float
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      bool result = left_float_number <= right_float_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle unsigned int / hex
-    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      bool result = left_unsigned_number <= right_unsigned_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // handle signed int / hex
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      bool result = left_signed_number <= right_signed_number;
-      return bosl_object_allocate(
-        BOSL_OBJECT_VALUE_BOOL, BOSL_OBJECT_TYPE_BOOL, &result, sizeof( result ) );
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  } else if ( TOKEN_BANG_EQUAL == b->operator->type ) {
-    // get equality status
-    bosl_object_t* equality = object_equal( left, right, true );
-    // destroy object
-    destroy_object( left );
-    destroy_object( right );
-    // return result
-    return equality;
-  } else if ( TOKEN_EQUAL_EQUAL == b->operator->type ) {
-    // get equality status
-    bosl_object_t* equality = object_equal( left, right, false );
-    // destroy object
-    destroy_object( left );
-    destroy_object( right );
-    // return result
-    return equality;
-  } else if (
-    TOKEN_SHIFT_LEFT == b->operator->type
-    || TOKEN_SHIFT_RIGHT == b->operator->type ) {
-    // save type and destroy objects
-    bosl_object_value_type_t left_value_type = left->value_type;
-    bosl_object_type_t left_type = left->type;
-    bosl_object_type_t right_type = right->type;
-    destroy_object( left );
-    destroy_object( right );
-    // handle only valid types
-    if (
-      BOSL_OBJECT_TYPE_UINT_8 <= left_type
-      && BOSL_OBJECT_TYPE_INT_64 >= left_type
-      && BOSL_OBJECT_TYPE_UINT_8 <= right_type
-      && BOSL_OBJECT_TYPE_INT_64 >= right_type ) {
-      // determine max shift bit
-      size_t max_bit = 0;
-      switch ( left_type ) {
-        case BOSL_OBJECT_TYPE_INT_8:
-        case BOSL_OBJECT_TYPE_UINT_8:
-          max_bit = 8;
-          break;
-        case BOSL_OBJECT_TYPE_INT_16:
-        case BOSL_OBJECT_TYPE_UINT_16:
-          max_bit = 16;
-          break;
-        case BOSL_OBJECT_TYPE_INT_32:
-        case BOSL_OBJECT_TYPE_UINT_32:
-          max_bit = 32;
-          break;
-        case BOSL_OBJECT_TYPE_INT_64:
-        case BOSL_OBJECT_TYPE_UINT_64:
-          max_bit = 64;
-          break;
-        default:
-          bosl_interpreter_emit_error( b->operator, "Unknown left type" );
-          return NULL;
-      }
-      // handle invalid shift count
-      if (
-        (
-          BOSL_OBJECT_VALUE_INT_UNSIGNED == left_value_type
-          && max_bit <= ( size_t )right_unsigned_number
-        ) || (
-          BOSL_OBJECT_VALUE_INT_SIGNED == left_value_type
-          && (
-            max_bit <= ( size_t )right_signed_number
-            || 0 >= right_signed_number
-          )
-        ) ) {
-        bosl_error_raise(
-          b->operator,
-          "Bit amount to shift has to be positive and smaller than %zd.",
-          max_bit
-        );
-        interpreter->error = true;
-        return NULL;
-      }
-      // handle unsigned int / hex
-      if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == left_value_type ) {
-        uint64_t result;
-        if ( TOKEN_SHIFT_LEFT == b->operator->type ) {
-          result = left_unsigned_number << right_unsigned_number;
-        } else {
-          result = left_unsigned_number >> right_unsigned_number;
-        }
-        return bosl_object_allocate(
-          left_value_type,
-          BOSL_OBJECT_TYPE_UINT_64,
-          &result,
-          sizeof( result )
-        );
-      }
-      // handle signed int / hex
-      if ( BOSL_OBJECT_VALUE_INT_SIGNED == left_value_type ) {
-        if ( 0 > right_signed_number ) {
-          bosl_interpreter_emit_error( b->operator, "Bits to shift has to be positive." );
-          return NULL;
-        }
-        int64_t result;
-        if ( TOKEN_SHIFT_LEFT == b->operator->type ) {
-          result = left_signed_number << right_signed_number;
-        } else {
-          result = left_signed_number >> right_signed_number;
-        }
-        return bosl_object_allocate(
-          left_value_type,
-          BOSL_OBJECT_TYPE_INT_64,
-          &result,
-          sizeof( result )
-        );
-      }
-    } else {
-      bosl_interpreter_emit_error( b->operator, "Shifting is restricted to integers." );
-      return NULL;
-    }
-    // unsupported
-    bosl_interpreter_emit_error( b->operator, "Unknown error" );
-    return NULL;
-  }
-  // destroy object
-  destroy_object( left );
-  destroy_object( right );
-  // raise error and return NULL
-  bosl_interpreter_emit_error( b->operator, "Unknown binary token." );
-  // anything else is an error
-  return NULL;
+  return bosl_value_binary( b->operator, &left, &right, value );
 }
 
 /**
  * @brief Helper to evaluate unary
  *
  * @param u
+ * @param value
  * @return
- *
- * @todo consider types correctly
  */
-static bosl_object_t* evaluate_unary( bosl_ast_expression_unary_t* u ) {
+static bool evaluate_unary(
+  bosl_ast_expression_unary_t* u,
+  bosl_value_t* value
+) {
   // evaluate right
-  bosl_object_t* right = evaluate_expression( u->right );
-  if ( !right ) {
+  bosl_value_t right;
+  if ( !evaluate_expression( u->right, &right ) ) {
     bosl_interpreter_emit_error(
       u->operator, "Unable to evaluate right expression" );
-    return NULL;
-  }
-  // apply operators
-  if ( TOKEN_BANG == u->operator->type ) {
-    // truthy flag
-    bosl_object_t* truthy = object_truthy( right, true );
-    // free object
-    destroy_object( right );
-    // return result
-    return truthy;
-  } else if ( TOKEN_MINUS == u->operator->type ) {
-    // validate type
-    if ( right->value_type > BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
-      // raise error and return NULL
-      bosl_interpreter_emit_error( u->operator, "Expect numeric" );
-      // free object
-      destroy_object( right );
-      // return NULL
-      return NULL;
-    }
-    // minus unary is only possible for signed values, so just change it
-    if (
-      right->value_type != BOSL_OBJECT_VALUE_INT_SIGNED
-      && right->value_type != BOSL_OBJECT_VALUE_FLOAT ) {
-      // handle incompatible environment variables
-      if (
-        right->environment
-        && (
-          BOSL_OBJECT_TYPE_INT_8 > right->type
-          || BOSL_OBJECT_TYPE_INT_64 < right->type
-        ) ) {
-        // error message
-        bosl_interpreter_emit_error( u->operator, "Expected signed variable." );
-        // free object
-        destroy_object( right );
-        // return NULL
-        return NULL;
-      }
-      // convert if type is wrong, and it's not from environment
-      if (
-        !right->environment
-        && (
-          BOSL_OBJECT_TYPE_INT_8 > right->type
-          || BOSL_OBJECT_TYPE_INT_64 < right->type
-        ) ) {
-        // now just change to the largest possible integer
-        right->value_type = BOSL_OBJECT_VALUE_INT_SIGNED;
-        right->type = BOSL_OBJECT_TYPE_INT_64;
-      }
-    }
-    // variables for values
-    int64_t signed_number = 0;
-    uint64_t unsigned_number = 0;
-    long double float_number = 0;
-    // extract stuff
-    if ( !bosl_object_extract_number( right, &unsigned_number, &signed_number, &float_number ) ) {
-      // raise error
-      bosl_interpreter_emit_error(
-        u->operator, "Runtime error unable to extract number" );
-      // destroy object
-      destroy_object( right );
-      // return NULL
-      return NULL;
-    }
-    // cache value type
-    bosl_object_value_type_t type = right->value_type;
-    // destroy object
-    destroy_object( right );
-    // apply negotiation
-    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
-      float_number = -float_number;
-      return bosl_object_allocate(
-        type, BOSL_OBJECT_TYPE_FLOAT, &float_number, sizeof( float_number ) );
-    } else if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      signed_number = -signed_number;
-      return bosl_object_allocate(
-        type, BOSL_OBJECT_TYPE_INT_64, &signed_number, sizeof( signed_number ) );
-    }
-    // raise error
-    bosl_interpreter_emit_error( u->operator, "Runtime error unknown" );
-    // return NULL
-    return NULL;
-  } else if ( TOKEN_PLUS == u->operator->type ) {
-    // validate type
-    if (
-      right->value_type >= BOSL_OBJECT_VALUE_FLOAT
-      && right->value_type <= BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
-      // raise error and return NULL
-      bosl_interpreter_emit_error( u->operator, "Expect numeric" );
-      return NULL;
-    }
-    // just return right
-    return right;
-  } else if ( TOKEN_BINARY_ONE_COMPLEMENT == u->operator->type ) {
-    // validate type
-    if (
-      right->value_type >= BOSL_OBJECT_VALUE_INT_SIGNED
-      && right->value_type <= BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
-      // raise error and return NULL
-      bosl_interpreter_emit_error( u->operator, "Expect numeric integer" );
-      return NULL;
-    }
-    // variables for values
-    int64_t signed_number = 0;
-    uint64_t unsigned_number = 0;
-    long double float_number = 0;
-    // extract stuff
-    if ( !bosl_object_extract_number( right, &unsigned_number, &signed_number, &float_number ) ) {
-      bosl_interpreter_emit_error(
-        u->operator, "Runtime error unable to extract number" );
-      destroy_object( right );
-      return NULL;
-    }
-    bosl_object_value_type_t type = right->value_type;
-    destroy_object( right );
-    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
-      signed_number = ~signed_number;
-      return bosl_object_allocate(
-        type, BOSL_OBJECT_TYPE_INT_64, &signed_number, sizeof( signed_number ) );
-    } else if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
-      unsigned_number = ~unsigned_number;
-      return bosl_object_allocate(
-        type, BOSL_OBJECT_TYPE_UINT_64, &unsigned_number, sizeof( unsigned_number ) );
-    }
-    // just return right
-    bosl_interpreter_emit_error( u->operator, "Runtime error unknown" );
-    return NULL;
+    return false;
   }
-  // destroy right
-  destroy_object( right );
-  // raise error and return NULL
-  bosl_interpreter_emit_error( u->operator, "Unknown unary token." );
-  // anything else is an error
-  return NULL;
+  // apply operator
+  return bosl_value_unary( u->operator, &right, value );
 }
 
 /**
  * @brief Helper to evaluate given literal
  *
  * @param l
+ * @param value
  * @return
  */
-static bosl_object_t* evaluate_literal( bosl_ast_expression_literal_t* l ) {
-  // determine type
-  bosl_object_value_type_t type;
-  bosl_object_type_t object_type;
-  switch ( l->type ) {
-    case EXPRESSION_LITERAL_TYPE_BOOL:
-      type = BOSL_OBJECT_VALUE_BOOL;
-      object_type = BOSL_OBJECT_TYPE_BOOL;
-      break;
-    case EXPRESSION_LITERAL_TYPE_NULL:
-      type = BOSL_OBJECT_VALUE_NULL;
-      object_type = BOSL_OBJECT_TYPE_UNDEFINED;
-      break;
-    case EXPRESSION_LITERAL_TYPE_NUMBER_FLOAT:
-      type = BOSL_OBJECT_VALUE_FLOAT;
-      object_type = BOSL_OBJECT_TYPE_FLOAT;
-      break;
-    case EXPRESSION_LITERAL_TYPE_NUMBER_INT:
-      type = BOSL_OBJECT_VALUE_INT_UNSIGNED;
-      object_type = BOSL_OBJECT_TYPE_UINT_64;
-      break;
-    case EXPRESSION_LITERAL_TYPE_STRING:
-      type = BOSL_OBJECT_VALUE_STRING;
-      object_type = BOSL_OBJECT_TYPE_STRING;
-      break;
-    default:
-      bosl_interpreter_emit_error( NULL, "Unsupported object type in literal." );
-      return NULL;
+static bool evaluate_literal(
+  bosl_ast_expression_literal_t* l,
+  bosl_value_t* value
+) {
+  // build value
+  if ( !bosl_value_from_literal( l, value ) ) {
+    bosl_interpreter_emit_error( NULL, "Unsupported object type in literal." );
+    return false;
   }
-  // allocate object
-  return bosl_object_allocate( type, object_type, l->value, l->size );
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to evaluate a call
+ *
+ * @param c
+ * @param value
+ * @return
+ */
+static bool evaluate_call(
+  bosl_ast_expression_call_t* c,
+  bosl_value_t* value
+) {
+  // evaluate callee expression
+  bosl_value_t callee;
+  if ( !evaluate_expression( c->callee, &callee ) ) {
+    bosl_interpreter_emit_error( c->paren, "Unable to evaluate callee expression." );
+    return false;
+  }
+  // handle not a callable
+  if ( BOSL_OBJECT_VALUE_CALLABLE != callee.value_type ) {
+    bosl_interpreter_emit_error( c->paren, "Not a callable function." );
+    bosl_value_release( &callee );
+    return false;
+  }
+  // extract callee information
+  bosl_object_callable_t* callable = callee.object->data;
+  // use inline space for arguments or allocate if necessary
+  size_t passed = vector_size( c->arguments );
+  bosl_value_t inline_argument[ INTERPRETER_INLINE_ARGUMENT ];
+  bosl_value_t* argument = inline_argument;
+  arena_mark_t mark = arena_mark( interpreter->arena );
+  if ( INTERPRETER_INLINE_ARGUMENT < passed ) {
+    argument = arena_allocate(
+      interpreter->arena, sizeof( bosl_value_t ) * passed );
+    if ( !argument ) {
+      bosl_interpreter_emit_error( c->paren, "Unable to allocate list for arguments." );
+      bosl_value_release( &callee );
+      return false;
+    }
+  }
+  // evaluate arguments
+  for ( size_t index = 0; index < passed; index++ ) {
+    // evaluate argument
+    if ( !evaluate_expression(
+      vector_at( c->arguments, index ), &argument[ index ] ) ) {
+      bosl_interpreter_emit_error(
+        c->paren, "Unable to evaluate parameter expression." );
+      release_argument( argument, 0, index );
+      free_argument( argument, inline_argument, mark );
+      bosl_value_release( &callee );
+      return false;
+    }
+    // detach argument from environment
+    if ( !bosl_value_own( &argument[ index ] ) ) {
+      bosl_interpreter_emit_error(
+        c->paren, "Unable to duplicate parameter object." );
+      release_argument( argument, 0, index );
+      free_argument( argument, inline_argument, mark );
+      bosl_value_release( &callee );
+      return false;
+    }
+  }
+  // check amount of passed arguments
+  if ( vector_size( callable->statement->parameter ) != passed ) {
+    bosl_interpreter_emit_error(
+      c->paren,
+      "Argument mismatch, to less or much parameters passed."
+    );
+    release_argument( argument, 0, passed );
+    free_argument( argument, inline_argument, mark );
+    bosl_value_release( &callee );
+    return false;
+  }
+  // call function
+  bool result = call_function( callee.object, argument, passed, value );
+  // free arguments and release callee
+  free_argument( argument, inline_argument, mark );
+  bosl_value_release( &callee );
+  // return result
+  return result;
 }
 
 /**
  * @brief Evaluates given expression
  *
  * @param e
+ * @param value
  * @return
  */
-static bosl_object_t* evaluate_expression( bosl_ast_expression_t* e ) {
+static bool evaluate_expression(
+  bosl_ast_expression_t* e,
+  bosl_value_t* value
+) {
   switch ( e->type ) {
     case EXPRESSION_ASSIGN: {
-      // evaluate expression and duplicate if from environment
-      bosl_object_t* value = bosl_object_duplicate_environment(
-        evaluate_expression( e->assign->value ) );
-      // handle error
-      if ( !value ) {
+      // evaluate expression
+      bosl_value_t assign;
+      if ( !evaluate_expression( e->assign->value, &assign ) ) {
         bosl_interpreter_emit_error( e->assign->token, "Unable to evaluate assign expression." );
-        return NULL;
+        return false;
       }
-      // assign object value
+      // assign value
       if ( !bosl_object_assign_push_value(
         interpreter->env,
+        e->assign->depth,
+        e->assign->slot,
         e->assign->token,
         NULL,
-        value,
+        &assign,
+        false,
         false
       ) ) {
         bosl_interpreter_emit_error( e->assign->token, "Assignment failed." );
-        destroy_object( value );
-        return NULL;
+        return false;
       }
-      // NULL return is okay here
-      return NULL;
+      // assignment has no value
+      return false;
     }
     case EXPRESSION_BINARY:
-      return evaluate_binary( e->binary );
-    case EXPRESSION_CALL: {
-      // evaluate callee expression
-      bosl_object_t* object = evaluate_expression(
-        e->call->callee
-      );
-      // handle error
-      if ( !object ) {
-        bosl_interpreter_emit_error( e->call->paren, "Unable to evaluate callee expression." );
-        return NULL;
-      }
-      // handle not a callable
-      if ( BOSL_OBJECT_VALUE_CALLABLE != object->value_type ) {
-        bosl_interpreter_emit_error( e->call->paren, "Not a callable function." );
-        return NULL;
-      }
-      // extract callee information
-      bosl_object_callable_t* callee = object->data;
-      // build list of arguments
-      list_manager_t* argument_list = list_construct(
-        NULL, object_list_cleanup, NULL );
-      if ( !argument_list ) {
-        bosl_interpreter_emit_error( e->call->paren, "Unable to allocate list for arguments." );
-        destroy_object( object );
-        return NULL;
-      }
-      // evaluate arguments
-      list_item_t* current_item = e->call->arguments->first;
-      while ( current_item ) {
-        // evaluate argument
-        bosl_object_t* argument = evaluate_expression( current_item->data );
-        if ( !argument ) {
-          bosl_interpreter_emit_error(
-            e->call->paren, "Unable to evaluate parameter expression." );
-          list_destruct( argument_list );
-          destroy_object( object );
-          return NULL;
-        }
-        argument = bosl_object_duplicate_environment( argument );
-        if ( !argument ) {
-          bosl_interpreter_emit_error(
-            e->call->paren, "Unable to duplicate parameter object." );
-          list_destruct( argument_list );
-          destroy_object( object );
-          return NULL;
-        }
-        // push back
-        if ( !list_push_back_data( argument_list, argument ) ) {
-          bosl_interpreter_emit_error(
-            e->call->paren, "Unable to push back parameter object." );
-          list_destruct( argument_list );
-          destroy_object( object );
-          return NULL;
-        }
-        // get to next item
-        current_item = current_item->next;
-      }
-      // get expected and passed parameters
-      size_t expected = list_count_item( callee->statement->parameter );
-      size_t passed = list_count_item( argument_list );
-      // check amount of passed arguments
-      if ( expected != passed ) {
-        bosl_interpreter_emit_error(
-          e->call->paren,
-          "Argument mismatch, to less or much parameters passed."
-        );
-        list_destruct( argument_list );
-        destroy_object( object );
-        return NULL;
-      }
-      // call function
-      bosl_object_t* result = callee->callback( object, argument_list );
-      // in case an error occurred during execution or binding was executed,
-      // cleanup is slightly different
-      if ( interpreter->error || callee->statement->load_identifier ) {
-        // destruct list and object normally
-        list_destruct( argument_list );
-        destroy_object( object );
-      } else {
-        // cleanup
-        argument_list->cleanup = list_default_cleanup;
-        list_destruct( argument_list );
-        // destroy object
-        destroy_object( object );
-      }
-      // return result
-      return result;
-    }
+      return evaluate_binary( e->binary, value );
+    case EXPRESSION_CALL:
+      return evaluate_call( e->call, value );
     case EXPRESSION_LOAD:
     case EXPRESSION_POINTER: {
       break;
     }
     case EXPRESSION_GROUPING:
       // grouping is just a expression container
-      return evaluate_expression( e->grouping->expression );
+      return evaluate_expression( e->grouping->expression, value );
     case EXPRESSION_LITERAL:
       // literal evaluation
-      return evaluate_literal( e->literal );
+      return evaluate_literal( e->literal, value );
     case EXPRESSION_LOGICAL: {
       // evaluate left side
-      bosl_object_t* left = evaluate_expression(
-        e->logical->left
-      );
-      // handle error
-      if ( !left ) {
+      if ( !evaluate_expression( e->logical->left, value ) ) {
         bosl_interpreter_emit_error( e->logical->operator, "Unable to evaluate left side." );
-        return NULL;
+        return false;
       }
-      bosl_object_t* truthy = object_truthy( left, false );
-      if ( !truthy ) {
-        bosl_interpreter_emit_error( e->logical->operator, "Unable to allocate truthy object." );
-        destroy_object( left );
-        return NULL;
-      }
-      // bool pointer to access information
-      bool* flag = truthy->data;
+      bool flag = bosl_value_is_truthy( value );
       if (
         // handle logical or
-        ( TOKEN_OR_OR == e->logical->operator->type && *flag )
+        ( TOKEN_OR_OR == e->logical->operator->type && flag )
         // handle logical and
-        && ( TOKEN_AND_AND == e->logical->operator->type && !*flag ) ) {
-        destroy_object( truthy );
-        return left;
+        || ( TOKEN_AND_AND == e->logical->operator->type && !flag ) ) {
+        return true;
       }
-      // destroy object
-      destroy_object( truthy );
-      destroy_object( left );
+      // release left side
+      bosl_value_release( value );
       // return evaluation of right side
-      return evaluate_expression( e->logical->right );
+      return evaluate_expression( e->logical->right, value );
     }
     case EXPRESSION_UNARY:
-      return evaluate_unary( e->unary );
-    case EXPRESSION_VARIABLE:
-      return bosl_environment_get_value( interpreter->env, e->variable->name );
+      return evaluate_unary( e->unary, value );
+    case EXPRESSION_VARIABLE: {
+      bosl_object_t* object = bosl_environment_get_value(
+        interpreter->env,
+        e->variable->depth,
+        e->variable->slot,
+        e->variable->name
+      );
+      // handle not found
+      if ( !object ) {
+        return false;
+      }
+      // value refers to environment object
+      bosl_value_from_object( object, value );
+      return true;
+    }
   }
   bosl_interpreter_emit_error( NULL, "Unknown expression." );
-  return NULL;
+  return false;
+}
+
+/**
+ * @brief Helper to evaluate expression and check it for truthy
+ *
+ * @param e
+ * @param flag
+ * @return
+ */
+static bool evaluate_truthy( bosl_ast_expression_t* e, bool* flag ) {
+  bosl_value_t value;
+  // evaluate expression
+  if ( !evaluate_expression( e, &value ) ) {
+    return false;
+  }
+  // check for truthy and release it
+  *flag = bosl_value_is_truthy( &value );
+  bosl_value_release( &value );
+  return true;
+}
+
+/**
+ * @brief Evaluates given expression as condition
+ *
+ * @param e
+ * @param flag
+ * @return
+ *
+ * @note logical operators, negation and comparisons yield the flag directly
+ */
+static bool evaluate_condition( bosl_ast_expression_t* e, bool* flag ) {
+  switch ( e->type ) {
+    case EXPRESSION_GROUPING:
+      // grouping is just a expression container
+      return evaluate_condition( e->grouping->expression, flag );
+    case EXPRESSION_LOGICAL: {
+      // evaluate left side
+      if ( !evaluate_condition( e->logical->left, flag ) ) {
+        bosl_interpreter_emit_error( e->logical->operator, "Unable to evaluate left side." );
+        return false;
+      }
+      // short circuit logical or and logical and
+      if ( ( TOKEN_OR_OR == e->logical->operator->type ) == *flag ) {
+        return true;
+      }
+      // result is right side
+      return evaluate_condition( e->logical->right, flag );
+    }
+    case EXPRESSION_UNARY: {
+      // only negation is handled directly
+      if ( TOKEN_BANG != e->unary->operator->type ) {
+        break;
+      }
+      // evaluate right side
+      if ( !evaluate_condition( e->unary->right, flag ) ) {
+        bosl_interpreter_emit_error(
+          e->unary->operator, "Unable to evaluate right expression" );
+        return false;
+      }
+      // negate
+      *flag = !*flag;
+      return true;
+    }
+    case EXPRESSION_BINARY: {
+      // only comparisons are handled directly
+      switch ( e->binary->operator->type ) {
+        case TOKEN_BANG_EQUAL:
+        case TOKEN_EQUAL_EQUAL:
+        case TOKEN_GREATER:
+        case TOKEN_GREATER_EQUAL:
+        case TOKEN_LESS:
+        case TOKEN_LESS_EQUAL:
+          break;
+        default:
+          return evaluate_truthy( e, flag );
+      }
+      // evaluate left
+      bosl_value_t left;
+      if ( !evaluate_expression( e->binary->left, &left ) ) {
+        bosl_interpreter_emit_error( e->binary->operator, "Unable to evaluate left expression" );
+        return false;
+      }
+      // evaluate right
+      bosl_value_t right;
+      if ( !evaluate_expression( e->binary->right, &right ) ) {
+        bosl_interpreter_emit_error( e->binary->operator, "Unable to evaluate right expression" );
+        bosl_value_release( &left );
+        return false;
+      }
+      // compare
+      return bosl_value_compare( e->binary->operator, &left, &right, flag );
+    }
+    default:
+      break;
+  }
+  // anything else is checked for truthy
+  return evaluate_truthy( e, flag );
 }
 
 /**
@@ -1024,25 +487,87 @@ static bosl_object_t* evaluate_expression( bosl_ast_expression_t* e ) {
  */
 static void execute_print( bosl_ast_statement_t* s ) {
   // evaluate print expression
-  bosl_object_t* object = evaluate_expression(
-    s->print->expression
-  );
-  // handle error
-  if ( !object ) {
+  bosl_value_t value;
+  if ( !evaluate_expression( s->print->expression, &value ) ) {
     bosl_interpreter_emit_error( NULL, "Evaluate of inner expression for print failed." );
     return;
   }
-  // print via stringify
-  char* str = bosl_object_stringify( object );
+  // print via stringify into arena
+  arena_mark_t mark = arena_mark( interpreter->arena );
+  char* str = bosl_value_stringify_arena( &value, interpreter->arena );
+  // release value
+  bosl_value_release( &value );
   if ( !str ) {
+    arena_reset( interpreter->arena, mark );
     bosl_interpreter_emit_error( NULL, "Stringify of evaluated object failed." );
     return;
   }
   // print string
   fprintf( stdout, "%s\r\n", str );
-  // destroy object and string
-  destroy_object( object );
-  free( str );
+  // release string
+  arena_reset( interpreter->arena, mark );
+}
+
+/**
+ * @brief Helper to evaluate break / continue level
+ *
+ * @param s
+ * @return
+ *
+ * @note levels resolved by parser are used without evaluation
+ */
+static bool evaluate_level( bosl_ast_statement_t* s ) {
+  bool is_break = STATEMENT_BREAK == s->type;
+  // use resolved level if set
+  if ( s->break_continue->resolved_level ) {
+    interpreter->flow_level = ( int64_t )s->break_continue->resolved_level;
+    return true;
+  }
+  // evaluate level expression
+  bosl_value_t level;
+  if ( !evaluate_expression( s->break_continue->level, &level ) ) {
+    bosl_interpreter_emit_error(
+      s->break_continue->token,
+      is_break
+        ? "Unable to evaluate break condition."
+        : "Unable to evaluate continue condition."
+    );
+    return false;
+  }
+  // validate level
+  if ( !bosl_value_validate( NULL, BOSL_OBJECT_TYPE_INT_8, &level ) ) {
+    bosl_interpreter_emit_error(
+      s->break_continue->token,
+      is_break
+        ? "Break level has to be of type signed integer."
+        : "Continue level has to be of type signed integer."
+    );
+    bosl_value_release( &level );
+    return false;
+  }
+  // get level value
+  int64_t val = level.signed_number;
+  // handle invalid value
+  if ( 0 >= val ) {
+    bosl_interpreter_emit_error(
+      s->break_continue->token,
+      is_break
+        ? "Break level has to be positive."
+        : "Continue level has to be positive."
+    );
+    return false;
+  }
+  // handle more levels than loops are existing
+  if ( val > interpreter->loop_level ) {
+    bosl_interpreter_emit_error(
+      s->break_continue->token,
+      is_break ? "Break statement to high." : "Continue statement to high."
+    );
+    return false;
+  }
+  // set level
+  interpreter->flow_level = val;
+  return true;
 }
 
 /**
@@ -1050,13 +575,15 @@ static void execute_print( bosl_ast_statement_t* s ) {
  *
  * @param s
  * @return
+ *
+ * @note return value is placed within interpreter return value slot
  */
-static bosl_object_t* execute( bosl_ast_statement_t* s ) {
+static bosl_interpreter_flow_t execute( bosl_ast_statement_t* s ) {
   switch ( s->type ) {
     case STATEMENT_BLOCK: {
       // create new nested environment
-      bosl_environment_t* inner = bosl_environment_init(
-        interpreter->env );
+      bosl_environment_t* inner = bosl_environment_init_arena(
+        interpreter->arena, interpreter->env, s->block->slot_count );
       if ( !inner ) {
         bosl_interpreter_emit_error( NULL, "Unable to allocate nested environment." );
         break;
@@ -1066,38 +593,26 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
       // temporarily overwrite current env
       interpreter->env = inner;
       // execute statement per statement
-      list_item_t* current_statement = s->block->statements->first;
-      while ( current_statement ) {
+      vector_t* statements = s->block->statements;
+      for ( size_t index = 0; index < vector_size( statements ); index++ ) {
         // get statement
-        bosl_ast_statement_t* statement = current_statement->data;
+        bosl_ast_statement_t* statement = vector_at( statements, index );
         // execute it
-        bosl_object_t* r = execute( statement );
-        // handle return
-        if ( r && ( r->is_return || r->is_break || r->is_continue ) ) {
-          // duplicate return if environment variable
-          bosl_object_t* copy = bosl_object_duplicate_environment( r );
-          if ( !copy ) {
-            // destroy object
-            destroy_object( r );
-            // raise error
-            bosl_interpreter_emit_error(
-              NULL, "Unable to duplicate return / break object." );
-            break;
-          }
+        bosl_interpreter_flow_t flow = execute( statement );
+        // handle return, break and continue
+        if ( BOSL_INTERPRETER_FLOW_NORMAL != flow ) {
           // restore previous environment
           interpreter->env = previous_env;
           // destroy nested environment
           bosl_environment_free( inner );
-          // return object
-          return copy;
+          // pass through
+          return flow;
         }
         // handle error
         if ( interpreter->error ) {
           bosl_interpreter_emit_error( NULL, "Unable to execute block statement." );
           break;
         }
-        // get to next
-        current_statement = current_statement->next;
       }
       // restore interpreter environment
       interpreter->env = previous_env;
@@ -1105,10 +620,14 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
       bosl_environment_free( inner );
       break;
     }
-    case STATEMENT_EXPRESSION:
-      // expressions are just evaluated
-      evaluate_expression( s->expression->expression );
+    case STATEMENT_EXPRESSION: {
+      // expressions are just evaluated and the value is dropped
+      bosl_value_t value;
+      if ( evaluate_expression( s->expression->expression, &value ) ) {
+        bosl_value_release( &value );
+      }
       break;
+    }
     case STATEMENT_PARAMETER:
       // handled by function shouldn't appear alone
       bosl_interpreter_emit_error(
@@ -1119,7 +638,7 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
     case STATEMENT_FUNCTION: {
       // allocate callable object
       bosl_object_t* f = bosl_object_allocate_callable(
-        s->function, execute_function, interpreter->env );
+        s->function, NULL, interpreter->env );
       if ( !f ) {
         bosl_interpreter_emit_error(
           s->function->token,
@@ -1129,7 +648,7 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
       }
       // push to environment
       if ( !bosl_environment_push_value(
-        interpreter->env, s->function->token, f
+        interpreter->env, s->function->slot, f
       ) ) {
         // destroy object
         bosl_object_destroy( f );
@@ -1144,43 +663,17 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
     }
     case STATEMENT_IF: {
       // evaluate condition
-      bosl_object_t* condition = evaluate_expression(
-        s->if_else->if_condition );
-      if ( !condition ) {
+      bool flag;
+      if ( !evaluate_condition( s->if_else->if_condition, &flag ) ) {
         bosl_interpreter_emit_error( NULL, "Unable to evaluate condition." );
         break;
       }
-      // check condition for truthy
-      bosl_object_t* truthy = object_truthy( condition, false );
-      if ( !truthy ) {
-        bosl_interpreter_emit_error( NULL, "Unable to allocate truthy object." );
-        destroy_object( condition );
-        break;
-      }
-      bosl_object_t* r = NULL;
       // execute statements depending on condition
-      if ( *( ( bool* )( truthy->data ) ) ) {
-        r = execute( s->if_else->if_statement );
-      } else {
-        if ( s->if_else->else_statement ) {
-          r = execute( s->if_else->else_statement );
-        }
+      if ( flag ) {
+        return execute( s->if_else->if_statement );
       }
-      // destroy condition again
-      destroy_object( condition );
-      destroy_object( truthy );
-      // handle return
-      if ( r && ( r->is_return || r->is_break || r->is_continue ) ) {
-        bosl_object_t* copy = bosl_object_duplicate_environment( r );
-        if ( !copy ) {
-          // destroy object
-          destroy_object( r );
-          // raise error
-          bosl_interpreter_emit_error(
-            NULL, "Unable to duplicate return / break object." );
-          break;
-        }
-        return copy;
+      if ( s->if_else->else_statement ) {
+        return execute( s->if_else->else_statement );
       }
       break;
     }
@@ -1188,329 +681,155 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
       execute_print( s );
       break;
     case STATEMENT_RETURN: {
-      bosl_object_t* value = NULL;
-      if ( s->return_value->value ) {
-        // evaluate expression
-        value = evaluate_expression( s->return_value->value );
-        if ( !value ) {
-          bosl_interpreter_emit_error(
-            s->return_value->keyword,
-            "Unable to evaluate return expression."
-          );
-        }
-      } else {
-        // build null return
-        const char n[] = "NULL";
-        value = bosl_object_allocate(
-          BOSL_OBJECT_VALUE_NULL,
-          BOSL_OBJECT_TYPE_UNDEFINED,
-          n,
-          strlen( n ) + 1
+      bosl_value_t value = {
+        .value_type = BOSL_OBJECT_VALUE_NULL,
+        .type = BOSL_OBJECT_TYPE_UNDEFINED,
+      };
+      // evaluate expression, null is returned otherwise
+      if (
+        s->return_value->value
+        && !evaluate_expression( s->return_value->value, &value )
+      ) {
+        bosl_interpreter_emit_error(
+          s->return_value->keyword,
+          "Unable to evaluate return expression."
         );
-        if ( !value ) {
-          bosl_interpreter_emit_error(
-            s->return_value->keyword,
-            "Unable to allocate return object."
-          );
-          return NULL;
-        }
+        break;
       }
-      // duplicate if environment variable
-      bosl_object_t* copy = bosl_object_duplicate_environment( value );
-      if ( !copy ) {
+      // duplicate value if environment variable
+      if ( !bosl_value_own( &value ) ) {
         bosl_interpreter_emit_error( NULL, "Unable to duplicate return object.\r\n" );
         break;
       }
-      // set return flag
-      copy->is_return = true;
-      return copy;
+      // place value in return slot
+      interpreter->return_value = value;
+      return BOSL_INTERPRETER_FLOW_RETURN;
     }
     case STATEMENT_VARIABLE: {
-      bosl_object_t* value = NULL;
-      if ( s->variable->initializer ) {
-        // evaluate initializer
-        value = bosl_object_duplicate_environment(
-          evaluate_expression( s->variable->initializer )
-        );
-        if ( !value ) {
-          bosl_interpreter_emit_error(
-            s->variable->name,
-            "Unable to evaluate initializer expression."
-          );
-          break;
-        }
-      } else {
-        // default initializer null
-        const char n[] = "NULL";
-        value = bosl_object_allocate(
-          BOSL_OBJECT_VALUE_NULL,
-          BOSL_OBJECT_TYPE_UNDEFINED,
-          n,
-          strlen( n ) + 1
+      // default initializer null
+      bosl_value_t value = {
+        .value_type = BOSL_OBJECT_VALUE_NULL,
+        .type = BOSL_OBJECT_TYPE_UNDEFINED,
+      };
+      // evaluate initializer
+      if (
+        s->variable->initializer
+        && !evaluate_expression( s->variable->initializer, &value )
+      ) {
+        bosl_interpreter_emit_error(
+          s->variable->name,
+          "Unable to evaluate initializer expression."
         );
-        if ( !value ) {
-          bosl_interpreter_emit_error(
-            s->variable->name,
-            "Unable to allocate default initializer."
-          );
-          break;
-        }
+        break;
       }
       // push to environment
       if ( !bosl_object_assign_push_value(
         interpreter->env,
+        0,
+        s->variable->slot,
         s->variable->name,
         s->variable->type,
-        value,
+        &value,
+        false,
         true
       ) ) {
         bosl_interpreter_emit_error(
           s->variable->name,
           "Unable to push variable to environment."
         );
-        destroy_object( value );
         break;
       }
       break;
     }
     case STATEMENT_CONST: {
       // evaluate initializer
-      bosl_object_t* value = bosl_object_duplicate_environment(
-        evaluate_expression( s->variable->initializer )
-      );
-      // handle error
-      if ( !value ) {
+      bosl_value_t value;
+      if ( !evaluate_expression( s->variable->initializer, &value ) ) {
         bosl_interpreter_emit_error(
           s->variable->name,
           "Unable to evaluate constant initializer expression."
         );
         break;
       }
-      // set constant flag
-      value->constant = true;
-      // push to environment
+      // push to environment as constant
       if ( !bosl_object_assign_push_value(
         interpreter->env,
+        0,
+        s->variable->slot,
         s->variable->name,
         s->variable->type,
-        value,
+        &value,
+        true,
         true
       ) ) {
         bosl_interpreter_emit_error(
           s->variable->name,
           "Unable to push constant to environment."
         );
-        destroy_object( value );
         break;
       }
       break;
     }
     case STATEMENT_WHILE: {
+      bosl_interpreter_flow_t result = BOSL_INTERPRETER_FLOW_NORMAL;
       // increment loop level
       interpreter->loop_level++;
       // execute loop
       while ( true ) {
-        // check for break
-        if ( interpreter->loop_break_remaining ) {
-          interpreter->loop_break_remaining--;
-          break;
-        }
         // evaluate condition
-        bosl_object_t* condition = evaluate_expression(
-          s->while_loop->condition );
-        // handle error
-        if ( !condition ) {
+        bool flag;
+        if ( !evaluate_condition( s->while_loop->condition, &flag ) ) {
           bosl_interpreter_emit_error( NULL, "Unable to evaluate condition." );
           break;
         }
-        // check condition for truthy
-        bosl_object_t* truthy = object_truthy( condition, false );
-        if ( !truthy ) {
-          bosl_interpreter_emit_error( NULL, "Unable to allocate truthy object." );
-          destroy_object( condition );
-          break;
-        }
         // break if not true any longer
-        if ( !*( ( bool* )( truthy->data ) ) ) {
-          destroy_object( truthy );
-          destroy_object( condition );
+        if ( !flag ) {
           break;
         }
         // execute while body
-        bosl_object_t* r = execute( s->while_loop->body );
-        // destroy truthy and condition again
-        destroy_object( truthy );
-        destroy_object( condition );
+        bosl_interpreter_flow_t flow = execute( s->while_loop->body );
         // handle error
         if ( interpreter->error ) {
-          // destroy return if set ( shouldn't be set )
-          if ( r ) {
-            destroy_object( r );
-          }
           // stop endless loop
           break;
         }
         // handle return
-        if ( r && r->is_return ) {
-          bosl_object_t* copy = bosl_object_duplicate_environment( r );
-          if ( !copy ) {
-            bosl_interpreter_emit_error( NULL, "Unable to duplicate return object.\r\n" );
+        if ( BOSL_INTERPRETER_FLOW_RETURN == flow ) {
+          result = flow;
+          break;
+        }
+        // handle break and continue
+        if (
+          BOSL_INTERPRETER_FLOW_BREAK == flow
+          || BOSL_INTERPRETER_FLOW_CONTINUE == flow
+        ) {
+          // pass through if an outer loop is targeted
+          if ( --interpreter->flow_level ) {
+            result = flow;
             break;
           }
-          return copy;
-        }
-        // handle continue
-        if ( r && r->is_continue ) {
-          // fill remaining breaks, normally one but could be more
-          memcpy(
-            &interpreter->loop_continue_remaining,
-            r->data,
-            sizeof( int64_t ) );
-          interpreter->loop_continue_remaining--;
-          // destroy object and reset pointer
-          destroy_object( r );
-          r = NULL;
-          // break out if more than one level shall be continued
-          if ( interpreter->loop_continue_remaining ) {
+          // leave loop on break
+          if ( BOSL_INTERPRETER_FLOW_BREAK == flow ) {
             break;
           }
         }
-        // handle break
-        if ( r && r->is_break ) {
-          // fill remaining breaks, normally one but could be more
-          memcpy(
-            &interpreter->loop_break_remaining,
-            r->data,
-            sizeof( int64_t ) );
-          interpreter->loop_break_remaining--;
-          // destroy object and reset pointer
-          destroy_object( r );
-          r = NULL;
-          break;
-        }
-      }
-      break;
-    }
-    case STATEMENT_BREAK: {
-      bosl_object_t* level = NULL;
-      if ( s->break_continue->level ) {
-        // evaluate level expression
-        level = evaluate_expression( s->break_continue->level );
-        if ( !level ) {
-          bosl_interpreter_emit_error(
-            s->break_continue->token,
-            "Unable to evaluate break condition." );
-          break;
-        }
-      }
-      // allocate default level if not allocated
-      if ( !level ) {
-        uint64_t i = 1;
-        level = bosl_object_allocate(
-          BOSL_OBJECT_VALUE_INT_UNSIGNED,
-          BOSL_OBJECT_TYPE_INT_8,
-          &i,
-          sizeof( i )
-        );
-        if ( !level ) {
-          bosl_interpreter_emit_error(
-            s->break_continue->token,
-            "Unable to allocate default break object value." );
-          break;
-        }
-      }
-      // validate return
-      if ( !bosl_object_validate( NULL, BOSL_OBJECT_TYPE_INT_8, level ) ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Break level has to be of type signed integer." );
-        destroy_object( level );
-        break;
       }
-      // get continue level
-      int64_t val = 0;
-      memcpy( &val, level->data, sizeof( val ) );
-      // handle invalid value
-      if ( 0 > val ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Negative break level is not allowed." );
-        destroy_object( level );
-        break;
-      }
-      // handle more levels than loops are existing
-      if ( val > interpreter->loop_level ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Break statement to high." );
-        destroy_object( level );
-        break;
-      }
-      // set break flag
-      level->is_break = true;
-      // return level
-      return level;
+      // decrement loop level
+      interpreter->loop_level--;
+      return result;
     }
-    case STATEMENT_CONTINUE: {
-      bosl_object_t* level = NULL;
-      if ( s->break_continue->level ) {
-        // evaluate level expression
-        level = evaluate_expression( s->break_continue->level );
-        if ( !level ) {
-          bosl_interpreter_emit_error(
-            s->break_continue->token,
-            "Unable to evaluate continue condition." );
-          break;
-        }
-      }
-      // allocate default level if not allocated
-      if ( !level ) {
-        uint64_t i = 1;
-        level = bosl_object_allocate(
-          BOSL_OBJECT_VALUE_INT_UNSIGNED,
-          BOSL_OBJECT_TYPE_INT_8,
-          &i,
-          sizeof( i )
-        );
-        if ( !level ) {
-          bosl_interpreter_emit_error(
-            s->break_continue->token,
-            "Unable to allocate default continue object value." );
-          break;
-        }
-      }
-      // validate return
-      if ( !bosl_object_validate( NULL, BOSL_OBJECT_TYPE_INT_8, level ) ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Continue level has to be of type signed integer." );
-        destroy_object( level );
-        break;
-      }
-      // get continue level
-      int64_t val = 0;
-      memcpy( &val, level->data, sizeof( val ) );
-      // handle invalid value
-      if ( 0 > val ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Negative continue level is not allowed." );
-        destroy_object( level );
+    case STATEMENT_BREAK:
+      // evaluate level and break
+      if ( !evaluate_level( s ) ) {
         break;
       }
-      // handle more levels than loops are existing
-      if ( val > interpreter->loop_level ) {
-        bosl_interpreter_emit_error(
-          s->break_continue->token,
-          "Continue statement to high." );
-        destroy_object( level );
+      return BOSL_INTERPRETER_FLOW_BREAK;
+    case STATEMENT_CONTINUE:
+      // evaluate level and continue
+      if ( !evaluate_level( s ) ) {
         break;
       }
-      // set break flag
-      level->is_continue = true;
-      // return level
-      return level;
-    }
+      return BOSL_INTERPRETER_FLOW_CONTINUE;
     case STATEMENT_POINTER: {
       bosl_interpreter_emit_error(
         s->pointer->name,
@@ -1521,133 +840,166 @@ static bosl_object_t* execute( bosl_ast_statement_t* s ) {
       bosl_interpreter_emit_error(
         NULL, "Unknown ast statement" );
   }
-  return NULL;
+  return BOSL_INTERPRETER_FLOW_NORMAL;
 }
 
 /**
- * @brief Helper to execute a script function
+ * @brief Helper to call a bound c function
  *
  * @param object
- * @param parameter
+ * @param argument
+ * @param count
+ * @param value
  * @return
+ *
+ * @note arguments are consumed and mustn't be used afterwards
  */
-static bosl_object_t* execute_function(
+static bool call_binding(
   bosl_object_t* object,
-  list_manager_t* parameter
+  bosl_value_t* argument,
+  size_t count,
+  bosl_value_t* value
+) {
+  // extract statement
+  bosl_ast_statement_function_t* statement =
+    ( ( bosl_object_callable_t* )object->data )->statement;
+  // try to get binding
+  bosl_object_t* binding = bosl_binding_get_atom(
+    statement->load_identifier->atom );
+  // handle no binding
+  if ( !binding ) {
+    bosl_interpreter_emit_error( statement->load_identifier, "Function binding not found." );
+    release_argument( argument, 0, count );
+    return false;
+  }
+  // handle invalid binding
+  if ( binding->value_type != BOSL_OBJECT_VALUE_CALLABLE ) {
+    bosl_interpreter_emit_error( statement->load_identifier, "Function binding is not a callable." );
+    release_argument( argument, 0, count );
+    return false;
+  }
+  // build list of arguments
+  vector_t* argument_list = vector_construct( object_list_cleanup );
+  if ( !argument_list ) {
+    bosl_interpreter_emit_error( NULL, "Unable to allocate list for arguments." );
+    release_argument( argument, 0, count );
+    return false;
+  }
+  // box arguments into list
+  for ( size_t index = 0; index < count; index++ ) {
+    bosl_object_t* parameter = bosl_value_box( &argument[ index ] );
+    if ( !parameter || !vector_push_back( argument_list, parameter ) ) {
+      bosl_interpreter_emit_error( NULL, "Unable to push back parameter object." );
+      if ( parameter ) {
+        destroy_object( parameter );
+      } else {
+        bosl_value_release( &argument[ index ] );
+      }
+      release_argument( argument, index + 1, count );
+      vector_destruct( argument_list );
+      return false;
+    }
+  }
+  // call binding
+  bosl_object_callable_t* binding_callable = binding->data;
+  bosl_object_t* result = binding_callable->callback( object, argument_list );
+  // destroy argument list
+  vector_destruct( argument_list );
+  // handle no result
+  if ( !result ) {
+    return false;
+  }
+  // unbox result
+  bosl_value_unbox( result, value );
+  return true;
+}
+
+/**
+ * @brief Helper to call a script function or binding
+ *
+ * @param object
+ * @param argument
+ * @param count
+ * @param value
+ * @return
+ *
+ * @note arguments are consumed and mustn't be used afterwards
+ */
+static bool call_function(
+  bosl_object_t* object,
+  bosl_value_t* argument,
+  size_t count,
+  bosl_value_t* value
 ) {
   // extract callable and statement
   bosl_object_callable_t* callable = object->data;
   bosl_ast_statement_function_t* statement = callable->statement;
   // handle load
   if ( statement->load_identifier ) {
-    // try to get binding
-    bosl_object_t* binding = bosl_binding_get_n(
-      statement->load_identifier->start,
-      statement->load_identifier->length
-    );
-    // handle no binding
-    if ( !binding ) {
-      bosl_interpreter_emit_error( statement->load_identifier, "Function binding not found." );
-      return NULL;
-    }
-    // handle invalid binding
-    if ( binding->value_type != BOSL_OBJECT_VALUE_CALLABLE ) {
-      bosl_interpreter_emit_error( statement->load_identifier, "Function binding is not a callable." );
-      return NULL;
-    }
-    // get callable
-    bosl_object_callable_t* binding_callable = binding->data;
-    // call binding and return
-    return binding_callable->callback( object, parameter );
+    return call_binding( object, argument, count, value );
   }
   // create new closure environment
-  bosl_environment_t* closure = bosl_environment_init( callable->closure );
+  bosl_environment_t* closure = bosl_environment_init_arena(
+    interpreter->arena, callable->closure, statement->slot_count );
   if ( !closure ) {
     bosl_interpreter_emit_error( NULL, "Unable to allocate closure for function execution." );
-    return NULL;
+    release_argument( argument, 0, count );
+    return false;
   }
-  // backup current environment
-  bosl_environment_t* previous_env = interpreter->env;
-  // temporarily overwrite current
-  interpreter->env = closure;
   // push parameter to environment
-  for ( size_t index = 0, max = list_count_item( parameter ); index < max; index++ ) {
-    // get argument name from list
-    bosl_ast_statement_t* argument = bosl_object_extract_parameter(
-      statement->parameter, index );
-    if ( !argument ) {
-      // restore interpreter environment
-      interpreter->env = previous_env;
-      // destroy closure
-      bosl_environment_free( closure );
-      bosl_interpreter_emit_error( NULL, "Unable to get parameter name from callable." );
-      return NULL;
-    }
-    // get value from list
-    bosl_object_t* value = bosl_object_extract_parameter( parameter, index );
-    if ( !value ) {
-      // restore interpreter environment
-      interpreter->env = previous_env;
-      // destroy closure
-      bosl_environment_free( closure );
-      bosl_interpreter_emit_error( NULL, "Unable to get parameter value for callable." );
-      return NULL;
-    }
+  for ( size_t index = 0; index < count; index++ ) {
+    bosl_ast_statement_t* parameter = vector_at( statement->parameter, index );
     // push to environment
     if ( !bosl_object_assign_push_value(
-      interpreter->env,
-      argument->parameter->name,
-      argument->parameter->type,
-      value,
+      closure,
+      0,
+      parameter->parameter->slot,
+      parameter->parameter->name,
+      parameter->parameter->type,
+      &argument[ index ],
+      false,
       true
     ) ) {
-      // restore interpreter environment
-      interpreter->env = previous_env;
+      // release remaining arguments
+      release_argument( argument, index + 1, count );
       // destroy closure
       bosl_environment_free( closure );
       bosl_interpreter_emit_error( NULL, "Unable to get parameter value for callable." );
-      return NULL;
+      return false;
     }
   }
+  // backup current environment and loop level
+  bosl_environment_t* previous_env = interpreter->env;
+  int64_t previous_loop_level = interpreter->loop_level;
+  // temporarily overwrite current
+  interpreter->env = closure;
+  interpreter->loop_level = 0;
   // execute function
-  bosl_object_t* o = execute( statement->body );
-  // handle return
-  if ( o && o->is_return ) {
-    // validate return
-    if ( !bosl_object_validate( statement->return_type, o->type, o ) ) {
-      // destroy object
-      destroy_object( o );
-      // restore interpreter environment
-      interpreter->env = previous_env;
-      // destroy closure
-      bosl_environment_free( closure );
-      bosl_interpreter_emit_error(
-        statement->return_type,
-        "Invalid return value received."
-      );
-      return NULL;
-    }
-    // duplicate if environment object
-    bosl_object_t* copy = bosl_object_duplicate_environment( o );
-    if ( !copy ) {
-      // destroy object
-      destroy_object( o );
-      // restore interpreter environment
-      interpreter->env = previous_env;
-      // destroy closure
-      bosl_environment_free( closure );
-      bosl_interpreter_emit_error( NULL, "Unable to duplicate return object after function." );
-      return NULL;
-    }
-    // overwrite o with copy
-    o = copy;
-  }
-  // restore interpreter environment
+  bosl_interpreter_flow_t flow = execute( statement->body );
+  // restore interpreter environment and loop level
   interpreter->env = previous_env;
+  interpreter->loop_level = previous_loop_level;
+  // handle no return
+  if ( BOSL_INTERPRETER_FLOW_RETURN != flow ) {
+    bosl_environment_free( closure );
+    return false;
+  }
+  // take over return value, it's never an environment object
+  *value = interpreter->return_value;
+  interpreter->return_value.value_type = BOSL_OBJECT_VALUE_VOID;
   // destroy closure
   bosl_environment_free( closure );
-  // return copy
-  return o;
+  // validate return
+  if ( !bosl_value_validate( statement->return_type, value->type, value ) ) {
+    bosl_value_release( value );
+    bosl_interpreter_emit_error(
+      statement->return_type,
+      "Invalid return value received."
+    );
+    return false;
+  }
+  // return success
+  return true;
 }
 
 /**
@@ -1662,21 +1014,27 @@ static void execute_ast_node( bosl_ast_node_t* node ) {
     bosl_interpreter_emit_error( NULL, "Invalid ast node" );
     return;
   }
-  // reset loop break remaining, continue remaining and loop level
-  interpreter->loop_break_remaining = 0;
-  interpreter->loop_continue_remaining = 0;
+  // reset flow level and loop level
+  interpreter->flow_level = 0;
   interpreter->loop_level = 0;
-  // execute statement
-  execute( node->statement );
+  // execute statement and drop return value outside of function
+  if ( BOSL_INTERPRETER_FLOW_RETURN == execute( node->statement ) ) {
+    bosl_value_release( &interpreter->return_value );
+    interpreter->return_value.value_type = BOSL_OBJECT_VALUE_VOID;
+  }
 }
 
 /**
  * @brief Initialize interpreter
  *
  * @param ast
+ * @param engine
  * @return
  */
-bool bosl_interpreter_init( list_manager_t* ast ) {
+bool bosl_interpreter_init(
+  vector_t* ast,
+  bosl_interpreter_engine_t engine
+) {
   // handle already initialized
   if ( interpreter ) {
     return true;
@@ -1688,19 +1046,48 @@ bool bosl_interpreter_init( list_manager_t* ast ) {
   }
   // clear out
   memset( interpreter, 0, sizeof( bosl_interpreter_t ) );
+  // resolve variable references to environment slots
+  size_t global_slots;
+  if ( !bosl_resolver_resolve( ast, &global_slots ) ) {
+    free( interpreter );
+    interpreter = NULL;
+    return false;
+  }
+  // allocate arena for temporaries of a run
+  interpreter->arena = arena_construct();
+  if ( !interpreter->arena ) {
+    free( interpreter );
+    interpreter = NULL;
+    return false;
+  }
   // allocate environment
-  interpreter->env = bosl_environment_init( NULL );
+  interpreter->env = bosl_environment_init( NULL, global_slots );
   if ( !interpreter->env ) {
+    arena_destruct( interpreter->arena );
     free( interpreter );
+    interpreter = NULL;
     return false;
   }
   // populate
   interpreter->ast = ast;
-  interpreter->current_item = ast->first;
+  interpreter->current_index = 0;
   interpreter->current = current;
   interpreter->next = next;
   interpreter->previous = previous;
   interpreter->error = false;
+  interpreter->engine = engine;
+  interpreter->return_value.value_type = BOSL_OBJECT_VALUE_VOID;
+  // compile ast to bytecode if necessary
+  if ( BOSL_INTERPRETER_ENGINE_BYTECODE == engine ) {
+    interpreter->chunk = bosl_compiler_compile( ast );
+    if ( !interpreter->chunk ) {
+      bosl_environment_free( interpreter->env );
+      arena_destruct( interpreter->arena );
+      free( interpreter );
+      interpreter = NULL;
+      return false;
+    }
+  }
   // return success
   return true;
 }
@@ -1716,32 +1103,56 @@ void bosl_interpreter_free( void ) {
   if ( interpreter->env ) {
     bosl_environment_free( interpreter->env );
   }
+  if ( interpreter->chunk ) {
+    bosl_chunk_destroy( interpreter->chunk );
+  }
+  if ( interpreter->arena ) {
+    arena_destruct( interpreter->arena );
+  }
   // just free structure
   free( interpreter );
 }
 
+/**
+ * @brief Get chunk compiled during init
+ *
+ * @return chunk or NULL if not initialized with bytecode engine
+ */
+bosl_chunk_t* bosl_interpreter_chunk( void ) {
+  return interpreter ? interpreter->chunk : NULL;
+}
+
 /**
  * @brief Perform interpreter
  *
  * @return
  */
 bool bosl_interpreter_run( void ) {
-  // start with first ast item
-  list_item_t* current_item = interpreter->ast->first;
-  // loop as long as current is valid
-  while ( current_item ) {
-    // execute
-    execute_ast_node( current_item->data );
-    // handle error
-    if ( interpreter->error ) {
-      fprintf( stderr, "Some interpreter error occurred!\r\n" );
-      return false;
+  bool result = true;
+  // run bytecode
+  if ( BOSL_INTERPRETER_ENGINE_BYTECODE == interpreter->engine ) {
+    result = bosl_vm_run( interpreter, interpreter->chunk );
+  } else {
+    vector_t* ast = interpreter->ast;
+    // loop as long as current is valid and no error occurred
+    for (
+      size_t index = 0;
+      index < vector_size( ast ) && !interpreter->error;
+      index++
+    ) {
+      // execute
+      execute_ast_node( vector_at( ast, index ) );
     }
-    // get to next
-    current_item = current_item->next;
+    result = !interpreter->error;
   }
-  // return success
-  return true;
+  // release all temporaries of this run at once
+  arena_clear( interpreter->arena );
+  // handle error
+  if ( !result ) {
+    fprintf( stderr, "Some interpreter error occurred!\r\n" );
+  }
+  // return result
+  return result;
 }
 
 /**
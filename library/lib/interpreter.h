@@ -20,13 +20,19 @@
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/list.h"
+  #include "collection/vector.h"
+  #include "collection/arena.h"
   #include "ast/statement.h"
+  #include "value.h"
   typedef struct bosl_environment bosl_environment_t;
+  typedef struct bosl_chunk bosl_chunk_t;
 #else
-  #include <bosl/collection/list.h>
+  #include <bosl/collection/vector.h>
+  #include <bosl/collection/arena.h>
   #include <bosl/ast/statement.h>
+  #include <bosl/value.h>
   typedef struct bosl_environment bosl_environment_t;
+  typedef struct bosl_chunk bosl_chunk_t;
 #endif
 
 #if !defined( BOSL_INTERPRETER_H )
@@ -36,6 +42,18 @@
 extern "C" {
 #endif
 
+typedef enum {
+  BOSL_INTERPRETER_ENGINE_AST,
+  BOSL_INTERPRETER_ENGINE_BYTECODE,
+} bosl_interpreter_engine_t;
+
+typedef enum {
+  BOSL_INTERPRETER_FLOW_NORMAL,
+  BOSL_INTERPRETER_FLOW_BREAK,
+  BOSL_INTERPRETER_FLOW_CONTINUE,
+  BOSL_INTERPRETER_FLOW_RETURN,
+} bosl_interpreter_flow_t;
+
 typedef bosl_ast_statement_t* ( *interpreter_previous_t )( void );
 typedef bosl_ast_statement_t* ( *interpreter_current_t )( void );
 typedef bosl_ast_statement_t* ( *interpreter_next_t )( void );
@@ -47,18 +65,23 @@ typedef struct bosl_interpreter {
 
   bool error;
   bosl_environment_t* env;
+  arena_t* arena;
 
-  int64_t loop_break_remaining;
-  int64_t loop_continue_remaining;
+  int64_t flow_level;
   int64_t loop_level;
+  bosl_value_t return_value;
+
+  vector_t* ast;
+  size_t current_index;
 
-  list_manager_t* ast;
-  list_item_t* current_item;
+  bosl_interpreter_engine_t engine;
+  bosl_chunk_t* chunk;
 } bosl_interpreter_t;
 
-bool bosl_interpreter_init( list_manager_t* );
+bool bosl_interpreter_init( vector_t*, bosl_interpreter_engine_t );
 void bosl_interpreter_free( void );
 bool bosl_interpreter_run( void );
+bosl_chunk_t* bosl_interpreter_chunk( void );
 void bosl_interpreter_emit_error( bosl_token_t*, const char* );
 
 #ifdef __cplusplus
@@ -20,55 +20,27 @@
 #include <stdlib.h>
 #include <string.h>
 #include "object.h"
-#include "collection/hashmap.h"
+#include "collection/pool.h"
 #include "error.h"
 #include "environment.h"
-
-// for debug purposes only
-#include <stdio.h>
-#include <inttypes.h>
-
-static hashmap_table_t* type_map = NULL;
+#include "interpreter.h"
+#include "value.h"
 
 /**
  * @brief Init object handling stuff
  *
  * @return
+ *
+ * @note type names are recognized without any table, so nothing to set up
  */
 bool bosl_object_init( void ) {
-  // create and fill hash map
-  type_map = hashmap_construct( NULL );
-  if ( !type_map ) {
-    return false;
-  }
-  // populate hashmap with keywords
-  if (
-    !hashmap_value_set( type_map, "int8", ( void* )BOSL_OBJECT_TYPE_INT_8 )
-    || !hashmap_value_set( type_map, "int16", ( void* )BOSL_OBJECT_TYPE_INT_16 )
-    || !hashmap_value_set( type_map, "int32", ( void* )BOSL_OBJECT_TYPE_INT_32 )
-    || !hashmap_value_set( type_map, "int64", ( void* )BOSL_OBJECT_TYPE_INT_64 )
-    || !hashmap_value_set( type_map, "uint8", ( void* )BOSL_OBJECT_TYPE_UINT_8 )
-    || !hashmap_value_set( type_map, "uint16", ( void* )BOSL_OBJECT_TYPE_UINT_16 )
-    || !hashmap_value_set( type_map, "uint32", ( void* )BOSL_OBJECT_TYPE_UINT_32 )
-    || !hashmap_value_set( type_map, "uint64", ( void* )BOSL_OBJECT_TYPE_UINT_64 )
-    || !hashmap_value_set( type_map, "float", ( void* )BOSL_OBJECT_TYPE_FLOAT )
-    || !hashmap_value_set( type_map, "string", ( void* )BOSL_OBJECT_TYPE_STRING ) ) {
-    hashmap_destruct( type_map );
-    return false;
-  }
-  // return success
   return true;
 }
 
 /**
  * @brief Free object handling stuff
  */
-void bosl_object_free( void ) {
-  if ( !type_map ) {
-    return;
-  }
-  hashmap_destruct( type_map );
-}
+void bosl_object_free( void ) {}
 
 /**
  * @brief Destroy an object
@@ -82,10 +54,10 @@ void bosl_object_destroy( bosl_object_t* object ) {
   }
   // destroy data
   if ( object->data ) {
-    free( object->data );
+    pool_free( object->data, object->size );
   }
   // destroy object
-  free( object );
+  pool_free( object, sizeof( bosl_object_t ) );
 }
 
 /**
@@ -104,15 +76,19 @@ bosl_object_t* bosl_object_allocate(
   size_t size
 ) {
   // allocate object
-  bosl_object_t* o = malloc( sizeof( bosl_object_t ) );
+  bosl_object_t* o = pool_allocate( sizeof( bosl_object_t ) );
   if ( !o ) {
     return NULL;
   }
-  // allocate data
-  o->data = malloc( size );
-  if ( !o->data ) {
-    bosl_object_destroy( o );
-    return NULL;
+  // clear out
+  memset( o, 0, sizeof( bosl_object_t ) );
+  // allocate data if necessary
+  if ( size ) {
+    o->data = pool_allocate( size );
+    if ( !o->data ) {
+      bosl_object_destroy( o );
+      return NULL;
+    }
   }
   // populate data
   o->size = size;
@@ -120,10 +96,10 @@ bosl_object_t* bosl_object_allocate(
   o->type = object_type;
   o->environment = false;
   o->constant = false;
-  o->is_return = false;
-  o->is_break = false;
-  o->is_continue = false;
   // copy over
+  if ( !size ) {
+    return o;
+  }
   if ( BOSL_OBJECT_VALUE_BOOL == value_type ) {
     *( ( bool* )( o->data ) ) = *( ( bool* )data );
   } else {
@@ -147,12 +123,12 @@ bosl_object_t* bosl_object_allocate_callable(
   bosl_environment_t* closure
 ) {
   // allocate object
-  bosl_object_t* o = malloc( sizeof( bosl_object_t ) );
+  bosl_object_t* o = pool_allocate( sizeof( bosl_object_t ) );
   if ( !o ) {
     return NULL;
   }
   // allocate data
-  o->data = malloc( sizeof( bosl_object_callable_t ) );
+  o->data = pool_allocate( sizeof( bosl_object_callable_t ) );
   if ( !o->data ) {
     bosl_object_destroy( o );
     return NULL;
@@ -202,9 +178,6 @@ bosl_object_t* bosl_object_duplicate_environment( bosl_object_t* obj ) {
   }
   // copy over rest of necessary properties
   duplicate->constant = obj->constant;
-  duplicate->is_return = obj->is_return;
-  duplicate->is_break = obj->is_break;
-  duplicate->is_continue = obj->is_continue;
   // return duplicate
   return duplicate;
 }
@@ -217,11 +190,46 @@ bosl_object_t* bosl_object_duplicate_environment( bosl_object_t* obj ) {
  * @return
  */
 bosl_object_type_t bosl_object_str_to_type( const char* str, size_t length ) {
-  void* result = hashmap_value_get_n( type_map, str, length );
-  if ( !result ) {
+  bosl_object_type_t type = BOSL_OBJECT_TYPE_UNDEFINED;
+  // perfect hash on length and leading characters
+  switch ( length ) {
+    case 4:
+      type = BOSL_OBJECT_TYPE_INT_8;
+      break;
+    case 5:
+      switch ( str[ 0 ] ) {
+        case 'f':
+          type = BOSL_OBJECT_TYPE_FLOAT;
+          break;
+        case 'i':
+          type = '1' == str[ 3 ] ? BOSL_OBJECT_TYPE_INT_16
+            : '3' == str[ 3 ] ? BOSL_OBJECT_TYPE_INT_32
+            : BOSL_OBJECT_TYPE_INT_64;
+          break;
+        case 'u':
+          type = BOSL_OBJECT_TYPE_UINT_8;
+          break;
+      }
+      break;
+    case 6:
+      switch ( str[ 0 ] ) {
+        case 's':
+          type = BOSL_OBJECT_TYPE_STRING;
+          break;
+        case 'u':
+          type = '1' == str[ 4 ] ? BOSL_OBJECT_TYPE_UINT_16
+            : '3' == str[ 4 ] ? BOSL_OBJECT_TYPE_UINT_32
+            : BOSL_OBJECT_TYPE_UINT_64;
+          break;
+      }
+      break;
+  }
+  // compare with the only possible candidate
+  const char* name = bosl_object_type_to_str( type );
+  if ( !name || strncmp( name, str, length ) ) {
     return BOSL_OBJECT_TYPE_UNDEFINED;
   }
-  return ( bosl_object_type_t )result;
+  return type;
 }
 
 /**
@@ -231,113 +239,75 @@ bosl_object_type_t bosl_object_str_to_type( const char* str, size_t length ) {
  * @return
  */
 const char* bosl_object_type_to_str( bosl_object_type_t type ) {
-  // setup hashmap iterator
-  hashmap_iterator_t it = hashmap_iterator( type_map );
-  // convert type to void pointer
-  void* v = ( void* )type;
-  // loop through hashmap
-  while ( hashmap_next( &it ) ) {
-    if ( v == it.value ) {
-      return it.key;
-    }
-  }
-  return NULL;
-}
-
-/**
- * @brief Helper to check whether value fits into float
- *
- * @param name
- * @param value
- * @param object_type
- * @return
- */
-static bool value_fits_float( bosl_token_t* name, bosl_object_t* value ) {
-  // extract numbers
-  int64_t signed_number;
-  uint64_t unsigned_number;
-  long double float_number;
-  if ( !bosl_object_extract_number(
-    value,
-    &unsigned_number,
-    &signed_number,
-    &float_number
-  ) ) {
-    bosl_error_raise( name, "Unable to extract value number." );
-    return false;
-  }
-  // uint to double
-  if (
-    BOSL_OBJECT_TYPE_UINT_8 <= value->type
-    && BOSL_OBJECT_TYPE_UINT_64 >= value->type ) {
-    // test whether value can be stored safely by converting with conversion
-    // back and comparison
-    long double repr;
-    *( ( volatile long double* )&repr ) = ( long double )unsigned_number;
-    uint64_t round_trip_value = ( uint64_t )repr;
-    // handle no assign possible
-    if ( round_trip_value != unsigned_number ) {
-      bosl_error_raise(
-        name,
-        "Cannot assign value %"PRIu64" with type %s to %s "
-        "( cannot be converted safely ).", unsigned_number,
-        bosl_object_type_to_str( value->type ),
-        bosl_object_type_to_str( BOSL_OBJECT_TYPE_FLOAT )
-      );
-      return false;
-    }
-  } else {
-    // int to double conversion
-    // test whether value can be stored safely by converting with conversion
-    // back and comparison
-    long double repr;
-    *( ( volatile long double* )&repr ) = ( long double )signed_number;
-    int64_t round_trip_value = ( int64_t )repr;
-    // handle no assign possible
-    if ( round_trip_value != signed_number ) {
-      bosl_error_raise(
-        name,
-        "Cannot assign value %"PRId64" with type %s to %s "
-        "( cannot be converted safely ).", unsigned_number,
-        bosl_object_type_to_str( value->type ),
-        bosl_object_type_to_str( BOSL_OBJECT_TYPE_FLOAT )
-      );
-      return false;
-    }
+  switch ( type ) {
+    case BOSL_OBJECT_TYPE_INT_8:
+      return "int8";
+    case BOSL_OBJECT_TYPE_INT_16:
+      return "int16";
+    case BOSL_OBJECT_TYPE_INT_32:
+      return "int32";
+    case BOSL_OBJECT_TYPE_INT_64:
+      return "int64";
+    case BOSL_OBJECT_TYPE_UINT_8:
+      return "uint8";
+    case BOSL_OBJECT_TYPE_UINT_16:
+      return "uint16";
+    case BOSL_OBJECT_TYPE_UINT_32:
+      return "uint32";
+    case BOSL_OBJECT_TYPE_UINT_64:
+      return "uint64";
+    case BOSL_OBJECT_TYPE_FLOAT:
+      return "float";
+    case BOSL_OBJECT_TYPE_STRING:
+      return "string";
+    default:
+      return NULL;
   }
-  return true;
 }
 
 /**
  * @brief Helper to assign / push a value
  *
  * @param environment
- * @param object
+ * @param depth
+ * @param slot
+ * @param name
+ * @param type
  * @param value
+ * @param constant
  * @param push
  * @return
+ *
+ * @note value is consumed and mustn't be used afterwards
  */
 bool bosl_object_assign_push_value(
   bosl_environment_t* environment,
+  size_t depth,
+  size_t slot,
   bosl_token_t* name,
   bosl_token_t* type,
-  bosl_object_t* value,
+  bosl_value_t* value,
+  bool constant,
   bool push
 ) {
-  // variable for object type
+  // variable for object type and current object
   bosl_object_type_t object_type;
+  bosl_object_t* current = NULL;
   // check for constant if not pushing a variable
   if ( !push ) {
     // get current value
-    bosl_object_t* current = bosl_environment_get_value( environment, name );
+    current = bosl_environment_get_value(
+      environment, depth, slot, name );
     // handle error
     if ( !current ) {
       bosl_error_raise( name, "Variable not found." );
+      bosl_value_release( value );
       return false;
     }
     // check for constant
     if ( current->constant ) {
       bosl_error_raise( name, "Change a constant is not allowed." );
+      bosl_value_release( value );
       return false;
     }
     // use object type from current
@@ -346,146 +316,43 @@ bool bosl_object_assign_push_value(
     // handle missing type name
     if ( !type ) {
       bosl_error_raise( name, "Type token internally not passed." );
+      bosl_value_release( value );
       return false;
     }
     // set variable
     object_type = bosl_object_str_to_type( type->start, type->length );
   }
-
-  // Check usual incompatibilities
-  if (
-    (
-      // handle string expected but no string in value
-      BOSL_OBJECT_TYPE_STRING == object_type
-      && BOSL_OBJECT_TYPE_STRING != value->type
-    ) || (
-      // handle integer expected but decimal received
-      BOSL_OBJECT_TYPE_UINT_8 <= object_type
-      && BOSL_OBJECT_TYPE_INT_64 >= object_type
-      && (
-        BOSL_OBJECT_TYPE_BOOL == value->type
-        || BOSL_OBJECT_TYPE_FLOAT == value->type
-        || BOSL_OBJECT_TYPE_STRING == value->type
-      )
-    ) ) {
+  // check and convert value to object type
+  if ( !bosl_value_convert( name, object_type, value ) ) {
+    bosl_value_release( value );
+    return false;
+  }
+  // overwrite current object in place if possible
+  if ( current && bosl_value_store( current, value ) ) {
+    return true;
+  }
+  // box value for storage within environment
+  bosl_object_t* object = bosl_value_box( value );
+  if ( !object ) {
     bosl_error_raise(
-      name, "Cannot assign %s to %s.",
-      bosl_object_type_to_str( value->type ),
+      name, "Not enough memory for object type %s.",
       bosl_object_type_to_str( object_type )
     );
+    bosl_value_release( value );
     return false;
   }
-
-  // check whether it's possible to convert between types
-  if ( object_type != value->type ) {
-    // extract numbers
-    int64_t signed_number;
-    uint64_t unsigned_number;
-    long double float_number;
-    if ( !bosl_object_extract_number(
-      value,
-      &unsigned_number,
-      &signed_number,
-      &float_number
-    ) ) {
-      bosl_error_raise( name, "Unable to extract value number." );
-      return false;
-    }
-
-    // signed / unsigned integer to float conversion
-    if (
-      BOSL_OBJECT_TYPE_FLOAT == object_type
-      && BOSL_OBJECT_TYPE_UINT_8 <= value->type
-      && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
-      if ( !value_fits_float( name, value ) ) {
-        // return false
-        return false;
-      }
-      // allocate new data
-      void* new_data = malloc( sizeof( long double ) );
-      if ( !new_data ) {
-        bosl_error_raise(
-          name, "Not enough memory for object type %s.",
-          bosl_object_type_to_str( object_type )
-        );
-        // return false
-        return false;
-      }
-      // clear out
-      memset( new_data, 0, sizeof( long double ) );
-      // transform to bool
-      long double* new_val = new_data;
-      if (
-        BOSL_OBJECT_TYPE_UINT_8 <= value->type
-        && BOSL_OBJECT_TYPE_UINT_64 >= value->type ) {
-        *new_val = ( long double )unsigned_number;
-      } else {
-        *new_val = ( long double )float_number;
-      }
-      // free current data
-      free( value->data );
-      // set to new data
-      value->data = new_data;
-      value->size = sizeof( long double );
-    } else if (
-      BOSL_OBJECT_TYPE_UINT_8 <= object_type
-      && BOSL_OBJECT_TYPE_INT_64 >= object_type
-      && BOSL_OBJECT_TYPE_UINT_8 <= value->type
-      && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
-      bosl_object_type_t backup = value->type;
-      // transform value to string
-      char* value_str = bosl_object_stringify( value );
-      if ( !value_str ) {
-        // raise error
-        bosl_error_raise( name, "Not enough memory for stringify value." );
-        // return false
-        return false;
-      }
-      // temporary change type to possible new type
-      value->type = object_type;
-      // convert to string
-      char* converted_str = bosl_object_stringify( value );
-      // restore type
-      value->type = backup;
-      // handle error
-      if ( !converted_str ) {
-        // free string
-        free( value_str );
-        // raise error
-        bosl_error_raise( name, "Not enough memory for stringify value." );
-        // return false
-        return false;
-      }
-      // treat different string lengths or comparison mismatch as incompatible
-      if (
-        strlen( value_str ) != strlen( converted_str )
-        || 0 != strcmp( value_str, converted_str ) ) {
-        // raise error
-        bosl_error_raise(
-          name, "Range error: %s is not in range of type %s.",
-          value_str,
-          bosl_object_type_to_str( object_type )
-        );
-        // free strings
-        free( value_str );
-        free( converted_str );
-        // return false
-        return false;
-      }
-      // free strings again
-      free( value_str );
-      free( converted_str );
-    }
-  }
-
-  // set type of value
-  value->type = object_type;
+  // set constant flag
+  object->constant = constant;
   // push value if set to true
-  if ( push ) {
-    return bosl_environment_push_value( environment, name, value );
+  bool result = push
+    ? bosl_environment_push_value( environment, slot, object )
+    // otherwise try to assign it
+    : bosl_environment_assign_value( environment, depth, slot, name, object );
+  // destroy boxed object on error
+  if ( !result ) {
+    bosl_object_destroy( object );
   }
-  // otherwise try to assign it
-  return bosl_environment_assign_value( environment, name, value );
+  return result;
 }
 
 /**
@@ -534,176 +401,11 @@ bool bosl_object_extract_number(
  * @return
  */
 char* bosl_object_stringify( bosl_object_t* object ) {
-  const char* buffer;
-  // determine buffer size
-  size_t buffer_size = sizeof( char );
-  char count_buffer[8];
-  int digits = 0;
-  // variables for numbers
-  long double float_number;
-  int64_t signed_number = 0;
-  uint64_t unsigned_number = 0;
-  bool flag;
-  bosl_token_t* token = NULL;
-  // count by utilizing snprintf
-  switch ( object->type ) {
-    case BOSL_OBJECT_TYPE_BOOL:
-      memcpy( &flag, object->data, sizeof( flag ) );
-      digits = ( int )( flag ? strlen( "true" ) : strlen( "false" ) );
-      break;
-    case BOSL_OBJECT_TYPE_UINT_8: {
-      // copy number
-      memcpy( &unsigned_number, object->data, sizeof( unsigned_number ) );
-      // enforce 8 bit unsigned integer
-      unsigned_number = ( uint8_t )unsigned_number;
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRIu8, ( uint8_t )unsigned_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_UINT_16: {
-      // copy number
-      memcpy( &unsigned_number, object->data, sizeof( unsigned_number ) );
-      // enforce 16 bit unsigned integer
-      unsigned_number = ( uint16_t )unsigned_number;
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRIu16, ( uint16_t )unsigned_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_UINT_32: {
-      // copy number
-      memcpy( &unsigned_number, object->data, sizeof( unsigned_number ) );
-      // enforce 32 bit unsigned integer
-      unsigned_number = ( uint32_t )unsigned_number;
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRIu32, ( uint32_t )unsigned_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_UINT_64: {
-      memcpy( &unsigned_number, object->data, sizeof( unsigned_number ) );
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRIu64, unsigned_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_INT_8: {
-      // copy number
-      memcpy( &signed_number, object->data, sizeof( signed_number ) );
-      // enforce 8 bit signed integer
-      signed_number = ( int64_t )( ( int8_t )signed_number );
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRId8, ( int8_t )signed_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_INT_16: {
-      // copy number
-      memcpy( &signed_number, object->data, sizeof( signed_number ) );
-      // enforce 16 bit signed integer
-      signed_number = ( int16_t )signed_number;
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRId16, ( int16_t )signed_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_INT_32: {
-      // copy number
-      memcpy( &signed_number, object->data, sizeof( signed_number ) );
-      // enforce 32 bit signed integer
-      signed_number = ( int32_t )signed_number;
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRId32, ( int32_t )signed_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_INT_64: {
-      // copy number
-      memcpy( &signed_number, object->data, sizeof( signed_number ) );
-      // determine digits
-      digits = snprintf( count_buffer, 7, "%"PRId64, signed_number );
-      break;
-    }
-    case BOSL_OBJECT_TYPE_STRING:
-      digits = ( int )object->size;
-      break;
-    case BOSL_OBJECT_TYPE_FLOAT:
-      memcpy( &float_number, object->data, sizeof( float_number ) );
-      digits = snprintf( count_buffer, 7, "%Lf", float_number );
-      break;
-    case BOSL_OBJECT_TYPE_UNDEFINED:
-      if ( BOSL_OBJECT_VALUE_NULL == object->value_type ) {
-        digits = ( int )strlen( "null" );
-      } else if ( BOSL_OBJECT_VALUE_CALLABLE == object->value_type ) {
-        token = ( ( bosl_object_callable_t* )object->data )->statement->token;
-        int length = ( int )token->length;
-        digits = snprintf( count_buffer, 7, "<fn %*.*s>", length, length, token->start );
-      }
-      break;
-    default:
-      return NULL;
-  }
-  // handle error
-  if ( 0 >= digits ) {
-    return NULL;
-  }
-  // multiply buffer size with digit amount
-  buffer_size *= ( size_t )( digits + 1 );
-  // allocate buffer
-  buffer = malloc( buffer_size );
-  if ( !buffer ) {
-    return NULL;
-  }
-  // clear out
-  memset( buffer, 0, buffer_size );
-  // print to allocated buffer
-  switch ( object->type ) {
-    case BOSL_OBJECT_TYPE_BOOL:
-      sprintf( buffer, "%s", flag ? "true" : "false" );
-      break;
-    case BOSL_OBJECT_TYPE_UINT_8:
-      sprintf( buffer, "%"PRIu8, ( uint8_t )unsigned_number );
-      break;
-    case BOSL_OBJECT_TYPE_UINT_16:
-      sprintf( buffer, "%"PRIu16, ( uint16_t )unsigned_number );
-      break;
-    case BOSL_OBJECT_TYPE_UINT_32:
-      sprintf( buffer, "%"PRIu32, ( uint32_t )unsigned_number );
-      break;
-    case BOSL_OBJECT_TYPE_UINT_64:
-      sprintf( buffer, "%"PRIu64, unsigned_number );
-      break;
-    case BOSL_OBJECT_TYPE_INT_8:
-      sprintf( buffer, "%"PRId8, ( int8_t )signed_number );
-      break;
-    case BOSL_OBJECT_TYPE_INT_16:
-      sprintf( buffer, "%"PRId16, ( int16_t )signed_number );
-      break;
-    case BOSL_OBJECT_TYPE_INT_32:
-      sprintf( buffer, "%"PRId32, ( int32_t )signed_number );
-      break;
-    case BOSL_OBJECT_TYPE_INT_64:
-      sprintf( buffer, "%"PRId64, signed_number );
-      break;
-    case BOSL_OBJECT_TYPE_STRING:
-      strncpy( buffer, object->data, object->size );
-      break;
-    case BOSL_OBJECT_TYPE_FLOAT:
-      sprintf( buffer, "%Lf", float_number );
-      break;
-    case BOSL_OBJECT_TYPE_UNDEFINED:
-      if ( BOSL_OBJECT_VALUE_NULL == object->value_type ) {
-        sprintf( buffer, "null" );
-      } else if ( BOSL_OBJECT_VALUE_CALLABLE == object->value_type && token ) {
-        sprintf(
-          buffer, "<fn %*.*s>", ( int )token->length,
-          ( int )token->length, token->start
-        );
-      } else {
-        free( buffer );
-        return NULL;
-      }
-      break;
-    default:
-      free( buffer );
-      return NULL;
-  }
-  // return buffer
-  return buffer;
+  bosl_value_t value;
+  // get value view of object
+  bosl_value_from_object( object, &value );
+  // stringify value
+  return bosl_value_stringify( &value );
 }
 
 /**
@@ -713,131 +415,25 @@ char* bosl_object_stringify( bosl_object_t* object ) {
  * @param index
  * @return
  */
-void* bosl_object_extract_parameter( list_manager_t* list, size_t index ) {
-  // get list item
-  list_item_t* item = list_get_item_at_pos( list, index );
-  if ( !item ) {
-    return NULL;
-  }
-  // return data
-  return item->data;
+void* bosl_object_extract_parameter( vector_t* list, size_t index ) {
+  // return data or null if out of range
+  return vector_at( list, index );
 }
 
 /**
- * @brief Helper to validate an object
+ * @brief Release an object if it's not part of an environment
  *
- * @param name
- * @param value
- * @return
+ * @param object
  */
-bool bosl_object_validate(
-  bosl_token_t* name,
-  bosl_object_type_t object_type,
-  bosl_object_t* value
-) {
-  if ( name ) {
-    object_type = bosl_object_str_to_type(
-      name->start, name->length );
-  }
-  // Check usual incompatibilities
-  if (
-    (
-      // handle string expected but no string in value
-      BOSL_OBJECT_TYPE_STRING == object_type
-      && BOSL_OBJECT_TYPE_STRING != value->type
-    ) || (
-      // handle integer expected but decimal received
-      BOSL_OBJECT_TYPE_UINT_8 <= object_type
-      && BOSL_OBJECT_TYPE_INT_64 >= object_type
-      && (
-        BOSL_OBJECT_TYPE_BOOL == value->type
-        || BOSL_OBJECT_TYPE_FLOAT == value->type
-        || BOSL_OBJECT_TYPE_STRING == value->type
-      )
-    ) ) {
-    bosl_error_raise(
-      name, "Cannot assign %s to %s.",
-      bosl_object_type_to_str( value->type ),
-      bosl_object_type_to_str( object_type )
-    );
-    return false;
+void bosl_object_release( bosl_object_t* object ) {
+  // handle invalid object passed
+  if ( !object ) {
+    return;
   }
-
-  // check whether it's possible to convert between types
-  if ( object_type != value->type ) {
-    // extract numbers
-    int64_t signed_number;
-    uint64_t unsigned_number;
-    long double float_number;
-    if ( !bosl_object_extract_number(
-      value,
-      &unsigned_number,
-      &signed_number,
-      &float_number
-    ) ) {
-      bosl_error_raise( name, "Unable to extract value number." );
-      return false;
-    }
-
-    // signed / unsigned integer to float conversion
-    if (
-      BOSL_OBJECT_TYPE_FLOAT == object_type
-      && BOSL_OBJECT_TYPE_UINT_8 <= value->type
-      && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
-      if ( !value_fits_float( name, value ) ) {
-        bosl_error_raise( name, "Value to big for type float." );
-        return false;
-      }
-    } else if (
-      BOSL_OBJECT_TYPE_UINT_8 <= object_type
-      && BOSL_OBJECT_TYPE_INT_64 >= object_type
-      && BOSL_OBJECT_TYPE_UINT_8 <= value->type
-      && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
-      bosl_object_type_t backup = value->type;
-      // transform value to string
-      char* value_str = bosl_object_stringify( value );
-      if ( !value_str ) {
-        // raise error
-        bosl_error_raise( name, "Not enough memory for stringify value." );
-        // return null
-        return NULL;
-      }
-      // temporary change type to possible new type
-      value->type = object_type;
-      // convert to string
-      char* converted_str = bosl_object_stringify( value );
-      // restore type
-      value->type = backup;
-      // handle error
-      if ( !converted_str ) {
-        // free string
-        free( value_str );
-        // raise error
-        bosl_error_raise( name, "Not enough memory for stringify value." );
-        // return null
-        return false;
-      }
-      // treat different string lengths or comparison mismatch as incompatible
-      if (
-        strlen( value_str ) != strlen( converted_str )
-        || 0 != strcmp( value_str, converted_str ) ) {
-        // raise error
-        bosl_error_raise(
-          name, "Range error: %s is not in range of type %s.",
-          value_str,
-          bosl_object_type_to_str( object_type )
-        );
-        // free strings
-        free( value_str );
-        free( converted_str );
-        // return null
-        return false;
-      }
-      // free strings again
-      free( value_str );
-      free( converted_str );
-    }
+  // handle part of environment
+  if ( object->environment ) {
+    return;
   }
-  // success
-  return true;
+  // free object
+  bosl_object_destroy( object );
 }
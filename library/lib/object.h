@@ -21,13 +21,15 @@
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/list.h"
+  #include "collection/vector.h"
   #include "ast/statement.h"
   typedef struct bosl_environment bosl_environment_t;
+  typedef struct bosl_value bosl_value_t;
 #else
-  #include <bosl/collection/list.h>
+  #include <bosl/collection/vector.h>
   #include <bosl/ast/statement.h>
   typedef struct bosl_environment bosl_environment_t;
+  typedef struct bosl_value bosl_value_t;
 #endif
 
 #if !defined( BOSL_OBJECT_H )
@@ -63,6 +65,7 @@ typedef enum bosl_object_value_type {
   BOSL_OBJECT_VALUE_STRING,
   BOSL_OBJECT_VALUE_NULL,
   BOSL_OBJECT_VALUE_CALLABLE,
+  BOSL_OBJECT_VALUE_VOID,
 } bosl_object_value_type_t;
 
 typedef struct bosl_object {
@@ -72,18 +75,16 @@ typedef struct bosl_object {
   size_t size;
   bool environment;
   bool constant;
-  bool is_return;
-  bool is_break;
-  bool is_continue;
 } bosl_object_t;
 
 // type definition for function callback
-typedef bosl_object_t* ( *bosl_callback_t )( bosl_object_t*, list_manager_t* );
+typedef bosl_object_t* ( *bosl_callback_t )( bosl_object_t*, vector_t* );
 
 typedef struct bosl_object_callable {
   bosl_callback_t callback;
   bosl_ast_statement_function_t* statement;
   bosl_environment_t* closure;
+  size_t entry;
 } bosl_object_callable_t;
 
 bool bosl_object_init( void );
@@ -97,16 +98,16 @@ bosl_object_t* bosl_object_allocate_callable(
   bosl_environment_t*
 );
 bosl_object_t* bosl_object_duplicate_environment( bosl_object_t* );
-bool bosl_object_assign_push_value(
-  bosl_environment_t*, bosl_token_t*, bosl_token_t*, bosl_object_t*, bool );
+bool bosl_object_assign_push_value( bosl_environment_t*, size_t, size_t,
+  bosl_token_t*, bosl_token_t*, bosl_value_t*, bool, bool );
 
 bool bosl_object_extract_number(
   bosl_object_t*, uint64_t*, int64_t*, long double* );
 bosl_object_type_t bosl_object_str_to_type( const char*, size_t );
 const char* bosl_object_type_to_str( bosl_object_type_t );
 char* bosl_object_stringify( bosl_object_t* );
-void* bosl_object_extract_parameter( list_manager_t*, size_t );
-bool bosl_object_validate( bosl_token_t*, bosl_object_type_t, bosl_object_t* );
+void* bosl_object_extract_parameter( vector_t*, size_t );
+void bosl_object_release( bosl_object_t* );
 
 #ifdef __cplusplus
 }
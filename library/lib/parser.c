@@ -35,49 +35,19 @@ static bosl_ast_node_t* statement( void );
 
 static bosl_parser_t* parser = NULL;
 
-/**
- * @brief Cleanup helper for list of expressions
- *
- * @param item
- */
-static void list_expression_cleanup( list_item_t* item ) {
-  // destroy expression
-  bosl_ast_expression_destroy( item->data );
-  // call default cleanup
-  list_default_cleanup( item );
-}
-
-/**
- * @brief Cleanup helper for list of statements
- *
- * @param item
- */
-static void list_statement_cleanup( list_item_t* item ) {
-  // destroy statement
-  bosl_ast_statement_destroy( item->data );
-  // call default cleanup
-  list_default_cleanup( item );
-}
-
-/**
- * @brief Cleanup helper for list of nodes
- *
- * @param item
- */
-static void list_node_cleanup( list_item_t* item ) {
-  // destroy node
-  bosl_ast_node_destroy( item->data );
-  // call default cleanup
-  list_default_cleanup( item );
-}
-
 /**
  * @brief Previous token helper
  *
  * @return
+ *
+ * @note token is retained on first call, so that it can be referenced by ast
  */
 static bosl_token_t* previous( void ) {
-  return ( bosl_token_t* )( parser->current_item->previous->data );
+  if ( !parser->previous_retained ) {
+    parser->previous_retained = bosl_scanner_retain_token(
+      parser->previous_token );
+  }
+  return parser->previous_retained;
 }
 
 /**
@@ -86,7 +56,17 @@ static bosl_token_t* previous( void ) {
  * @return
  */
 static bosl_token_t* current( void ) {
-  return ( bosl_token_t* )( parser->current_item->data );
+  return bosl_scanner_peek_token( 0 );
+}
+
+/**
+ * @brief Helper to consume current token without retaining it
+ */
+static void advance( void ) {
+  if ( TOKEN_EOF != parser->current()->type ) {
+    parser->previous_token = bosl_scanner_next_token();
+    parser->previous_retained = NULL;
+  }
 }
 
 /**
@@ -95,9 +75,7 @@ static bosl_token_t* current( void ) {
  * @return
  */
 static bosl_token_t* next( void ) {
-  if ( TOKEN_EOF != parser->current()->type ) {
-    parser->current_item = parser->current_item->next;
-  }
+  advance();
   return parser->previous();
 }
 
@@ -113,7 +91,7 @@ static bool match( bosl_token_type_t type ) {
     return false;
   }
   // push to next
-  parser->next();
+  advance();
   // return success
   return true;
 }
@@ -137,6 +115,26 @@ static bosl_token_t* consume( bosl_token_type_t type, const char* error_message
   return parser->next();
 }
 
+/**
+ * @brief Head over to next on match without retaining, else raise an error
+ *
+ * @param type
+ * @param error_message
+ * @return
+ */
+static bool expect( bosl_token_type_t type, const char* error_message ) {
+  // check for mismatch
+  if ( parser->current()->type != type ) {
+    // raise error and return false
+    bosl_error_raise( parser->current(), "%s", error_message );
+    return false;
+  }
+  // push to next
+  advance();
+  // return success
+  return true;
+}
+
 /**
  * @brief Handle primary expression
  *
@@ -146,75 +144,56 @@ static bosl_ast_expression_t* expression_primary( void ) {
   if ( match( TOKEN_FALSE ) ) {
     bool b = false;
     return bosl_ast_expression_allocate_literal(
-      &b, sizeof( b ), EXPRESSION_LITERAL_TYPE_BOOL );
+      parser->arena, &b, sizeof( b ), EXPRESSION_LITERAL_TYPE_BOOL );
   }
   if ( match( TOKEN_TRUE ) ) {
     bool b = true;
     return bosl_ast_expression_allocate_literal(
-      &b, sizeof( b ), EXPRESSION_LITERAL_TYPE_BOOL );
+      parser->arena, &b, sizeof( b ), EXPRESSION_LITERAL_TYPE_BOOL );
   }
   if ( match( TOKEN_NULL ) ) {
     return bosl_ast_expression_allocate_literal(
-      NULL, 0, EXPRESSION_LITERAL_TYPE_NULL );
+      parser->arena, NULL, 0, EXPRESSION_LITERAL_TYPE_NULL );
   }
 
   if ( match( TOKEN_STRING ) ) {
     bosl_token_t* token = parser->previous();
     return bosl_ast_expression_allocate_literal(
-      token->start,
+      parser->arena, token->start,
       sizeof( char ) * ( token->length ),
       EXPRESSION_LITERAL_TYPE_STRING
     );
   }
 
   if ( match( TOKEN_NUMBER ) ) {
-    // get token
+    // get token with value decoded by scanner
     bosl_token_t* token = parser->previous();
-    const char* s = token->start;
-    const char* se = token->start + token->length;
-    // detect float / hex
-    bool is_float = false;
-    bool is_hex = false;
-    while ( s < se ) {
-      if ( '.' == *s ) {
-        is_float = true;
-      }
-      if ( 'x' == *s ) {
-        is_hex = true;
-      }
-      s++;
-    }
-    // float and hex is not possible
-    if ( is_float && is_hex ) {
+    if ( !token ) {
       return NULL;
     }
-
-    char* end;
-    if ( is_float ) {
-      // push float literal
-      long double num = strtold( token->start, &end );
-      if ( end != token->start + token->length ) {
+    switch ( token->number_type ) {
+      case TOKEN_NUMBER_TYPE_FLOAT:
+        // push float literal
+        return bosl_ast_expression_allocate_literal(
+          parser->arena,
+          &token->float_number, sizeof( token->float_number ),
+          EXPRESSION_LITERAL_TYPE_NUMBER_FLOAT );
+      case TOKEN_NUMBER_TYPE_INT:
+        // push number literal
+        return bosl_ast_expression_allocate_literal(
+          parser->arena,
+          &token->unsigned_number, sizeof( token->unsigned_number ),
+          EXPRESSION_LITERAL_TYPE_NUMBER_INT );
+      default:
+        // number not decodable
         return NULL;
-      }
-      // push to literal
-      return bosl_ast_expression_allocate_literal(
-        &num, sizeof( num ), EXPRESSION_LITERAL_TYPE_NUMBER_FLOAT );
-    } else {
-      // push number literal
-      uint64_t num = strtoull( token->start, &end, 0 );
-      if ( end != token->start + token->length ) {
-        return NULL;
-      }
-      // push to literal
-      return bosl_ast_expression_allocate_literal(
-        &num, sizeof( num ), EXPRESSION_LITERAL_TYPE_NUMBER_INT );
     }
   }
 
   if ( match( TOKEN_IDENTIFIER ) ) {
     // create variable expression
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
-      EXPRESSION_VARIABLE );
+      parser->arena, EXPRESSION_VARIABLE );
     if ( !new_e ) {
       return NULL;
     }
@@ -231,14 +210,13 @@ static bosl_ast_expression_t* expression_primary( void ) {
       return NULL;
     }
     // expect closing parenthesis
-    if ( !consume( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after expression." ) ) {
-      bosl_ast_expression_destroy( e );
+    if ( !expect( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after expression." ) ) {
       return NULL;
     }
     // create group expression
-    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate( EXPRESSION_GROUPING );
+    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
+      parser->arena, EXPRESSION_GROUPING );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     // get pointer to data
@@ -262,8 +240,7 @@ static bosl_ast_expression_t* expression_call_finish(
 ) {
   bosl_token_t* current_token = parser->current();
   // create arguments list
-  list_manager_t* arguments = list_construct(
-    NULL, list_expression_cleanup, NULL );
+  vector_t* arguments = vector_construct_arena( parser->arena );
   if ( !arguments ) {
     return NULL;
   }
@@ -273,13 +250,10 @@ static bosl_ast_expression_t* expression_call_finish(
       // get argument expression
       bosl_ast_expression_t* arg = expression();
       if ( !arg ) {
-        list_destruct( arguments );
         return NULL;
       }
       // push back
-      if ( !list_push_back_data( arguments, arg ) ) {
-        bosl_ast_expression_destroy( arg );
-        list_destruct( arguments );
+      if ( !vector_push_back( arguments, arg ) ) {
         return NULL;
       }
     } while ( match( TOKEN_COMMA ) );
@@ -288,13 +262,12 @@ static bosl_ast_expression_t* expression_call_finish(
     TOKEN_RIGHT_PARENTHESIS, "Expected ')' after arguments." );
   // check for closing parenthesis
   if ( !previous_token ) {
-    list_destruct( arguments );
     return NULL;
   }
   // allocate call expression
-  bosl_ast_expression_t* e = bosl_ast_expression_allocate( EXPRESSION_CALL );
+  bosl_ast_expression_t* e = bosl_ast_expression_allocate(
+    parser->arena, EXPRESSION_CALL );
   if ( !e ) {
-    list_destruct( arguments );
     return NULL;
   }
   e->call->callee = callee;
@@ -319,7 +292,6 @@ static bosl_ast_expression_t* expression_call( void ) {
     if ( match( TOKEN_LEFT_PARENTHESIS ) ) {
       bosl_ast_expression_t* new_e = expression_call_finish( e );
       if ( !new_e ) {
-        bosl_ast_expression_destroy( e );
         return NULL;
       }
       // overwrite e
@@ -340,7 +312,8 @@ static bosl_ast_expression_t* expression_call( void ) {
 static bosl_ast_expression_t* expression_load( void ) {
   if ( match( TOKEN_IDENTIFIER ) ) {
     // create group expression
-    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate( EXPRESSION_LOAD );
+    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
+      parser->arena, EXPRESSION_LOAD );
     if ( !new_e ) {
       return NULL;
     }
@@ -362,7 +335,7 @@ static bosl_ast_expression_t* expression_pointer( void ) {
   if ( match( TOKEN_IDENTIFIER ) ) {
     // create pointer expression
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
-      EXPRESSION_POINTER );
+      parser->arena, EXPRESSION_POINTER );
     if ( !new_e ) {
       return NULL;
     }
@@ -392,9 +365,9 @@ static bosl_ast_expression_t* expression_unary( void ) {
     if ( !right ) {
       return NULL;
     }
-    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate( EXPRESSION_UNARY );
+    bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
+      parser->arena, EXPRESSION_UNARY );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // populate
@@ -433,14 +406,11 @@ static bosl_ast_expression_t* expression_factor( void ) {
     bosl_token_t* operator = parser->previous();
     bosl_ast_expression_t* right = expression_unary();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_binary(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -465,14 +435,11 @@ static bosl_ast_expression_t* expression_term( void ) {
     bosl_token_t* operator = parser->previous();
     bosl_ast_expression_t* right = expression_factor();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_binary(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -503,14 +470,11 @@ static bosl_ast_expression_t* expression_comparison( void ) {
     bosl_token_t* operator = parser->previous();
     bosl_ast_expression_t* right = expression_term();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_binary(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -535,14 +499,11 @@ static bosl_ast_expression_t* expression_equality( void ) {
     bosl_token_t* operator = parser->previous();
     bosl_ast_expression_t* right = expression_comparison();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_binary(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -571,14 +532,11 @@ static bosl_ast_expression_t* expression_and( void ) {
     // evaluate right expression
     bosl_ast_expression_t* right = expression_equality();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_logical(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -606,14 +564,11 @@ static bosl_ast_expression_t* expression_xor( void ) {
     // evaluate right expression
     bosl_ast_expression_t* right = expression_and();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_logical(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -641,14 +596,11 @@ static bosl_ast_expression_t* expression_or( void ) {
     // evaluate right expression
     bosl_ast_expression_t* right = expression_xor();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_logical(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -675,14 +627,11 @@ static bosl_ast_expression_t* expression_logic_and( void ) {
     // evaluate right expression
     bosl_ast_expression_t* right = expression_or();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_logical(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -709,14 +658,11 @@ static bosl_ast_expression_t* expression_logic_or( void ) {
     // evaluate right expression
     bosl_ast_expression_t* right = expression_logic_and();
     if ( !right ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
     bosl_ast_expression_t* new_e = bosl_ast_expression_allocate_logical(
-      e, operator, right );
+      parser->arena, e, operator, right );
     if ( !new_e ) {
-      bosl_ast_expression_destroy( e );
-      bosl_ast_expression_destroy( right );
       return NULL;
     }
     // overwrite e
@@ -744,29 +690,25 @@ static bosl_ast_expression_t* expression_assignment( void ) {
     // get value for assignment
     bosl_ast_expression_t* value = expression_assignment();
     if ( !value ) {
-      bosl_ast_expression_destroy( e );
       return NULL;
     }
 
     // handle variable
     if ( EXPRESSION_VARIABLE == e->type ) {
       // build and return assign expression
-      bosl_ast_expression_t* new_e = bosl_ast_expression_allocate( EXPRESSION_ASSIGN );
+      bosl_ast_expression_t* new_e = bosl_ast_expression_allocate(
+        parser->arena, EXPRESSION_ASSIGN );
       if ( !new_e ) {
-        bosl_ast_expression_destroy( e );
-        bosl_ast_expression_destroy( value );
         return NULL;
       }
       // populate inner data
       new_e->assign->token = e->variable->name;
       new_e->assign->value = value;
       // return assign expression
-      bosl_ast_expression_destroy( e );
       return new_e;
     }
     // raise error
     bosl_error_raise( previous_token, "Invalid assignment target." );
-    bosl_ast_expression_destroy( e );
     return NULL;
   }
   // return expression
@@ -789,57 +731,46 @@ static bosl_ast_expression_t* expression( void ) {
  */
 static bosl_ast_node_t* statement_if( void ) {
   // allocate new node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_IF );
+  node->statement = bosl_ast_statement_allocate( parser->arena, STATEMENT_IF );
   if ( !node->statement ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // expect opening parenthesis
-  if ( !consume( TOKEN_LEFT_PARENTHESIS, "Expect '(' after 'if'." ) ) {
-    bosl_ast_node_destroy( node );
+  if ( !expect( TOKEN_LEFT_PARENTHESIS, "Expect '(' after 'if'." ) ) {
     return NULL;
   }
   // evaluate expression
   bosl_ast_expression_t* if_expression = expression();
   if ( !if_expression ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // expect parenthesis
-  if ( !consume( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after 'if'." ) ) {
-    bosl_ast_node_destroy( node );
-    bosl_ast_expression_destroy( if_expression );
+  if ( !expect( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after 'if'." ) ) {
     return NULL;
   }
   // consume statement
   bosl_ast_node_t* if_statement = statement();
   if ( !if_statement ) {
-    bosl_ast_node_destroy( node );
-    bosl_ast_expression_destroy( if_expression );
     return NULL;
   }
   // populate node
   node->statement->if_else->if_condition = if_expression;
   node->statement->if_else->if_statement = if_statement->statement;
-  free( if_statement );
   // get possible else branch
   bosl_ast_node_t* else_branch = NULL;
   if ( match( TOKEN_ELSE ) ) {
     // get else branch
     else_branch = statement();
     if ( !else_branch ) {
-      bosl_ast_node_destroy( node );
       return NULL;
     }
     // add to node
     node->statement->if_else->else_statement = else_branch->statement;
-    // free container
-    free( else_branch );
   }
   // return node
   return node;
@@ -852,7 +783,7 @@ static bosl_ast_node_t* statement_if( void ) {
  */
 static bosl_ast_node_t* statement_print( void ) {
   // expect opening parenthesis
-  if ( !consume( TOKEN_LEFT_PARENTHESIS, "Expect '(' after print." ) ) {
+  if ( !expect( TOKEN_LEFT_PARENTHESIS, "Expect '(' after print." ) ) {
     return NULL;
   }
   // get expression
@@ -861,26 +792,22 @@ static bosl_ast_node_t* statement_print( void ) {
     return NULL;
   }
   // expect closing parenthesis
-  if ( !consume( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after expression." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after expression." ) ) {
     return NULL;
   }
   // expect semicolon
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' at end of print." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' at end of print." ) ) {
     return NULL;
   }
   // allocate new node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    bosl_ast_expression_destroy( e );
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_PRINT );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_PRINT );
   if ( !node->statement ) {
-    bosl_ast_expression_destroy( e );
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate
@@ -910,27 +837,18 @@ static bosl_ast_node_t* statement_return( void ) {
     value = expression();
   }
   // expect semicolon
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' after return value." ) ) {
-    if ( value ) {
-      bosl_ast_expression_destroy( value );
-    }
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' after return value." ) ) {
     return NULL;
   }
   // allocate new node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    if ( value ) {
-      bosl_ast_expression_destroy( value );
-    }
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_RETURN );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_RETURN );
   if ( !node->statement ) {
-    if ( value ) {
-      bosl_ast_expression_destroy( value );
-    }
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate
@@ -946,49 +864,49 @@ static bosl_ast_node_t* statement_return( void ) {
  * @return
  */
 static bosl_ast_node_t* statement_while( void ) {
-  // set in loop statement
+  // set in loop statement and increase loop level
   parser->in_loop = true;
+  parser->loop_level++;
   // Expect opening parenthesis
-  if ( !consume( TOKEN_LEFT_PARENTHESIS, "Expect '(' after 'while'." ) ) {
+  if ( !expect( TOKEN_LEFT_PARENTHESIS, "Expect '(' after 'while'." ) ) {
+    parser->loop_level--;
     return NULL;
   }
   // evaluate expression
   bosl_ast_expression_t* e = expression();
   if ( !e ) {
+    parser->loop_level--;
     return NULL;
   }
-  if ( !consume( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after condition." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_RIGHT_PARENTHESIS, "Expect ')' after condition." ) ) {
+    parser->loop_level--;
     return NULL;
   }
   // get body
   bosl_ast_node_t* body = statement();
   if ( !body ) {
-    bosl_ast_expression_destroy( e );
+    parser->loop_level--;
     return NULL;
   }
   // allocate new node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    bosl_ast_expression_destroy( e );
-    bosl_ast_node_destroy( body );
+    parser->loop_level--;
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_WHILE );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_WHILE );
   if ( !node->statement ) {
-    bosl_ast_expression_destroy( e );
-    bosl_ast_node_destroy( body );
-    bosl_ast_node_destroy( node );
+    parser->loop_level--;
     return NULL;
   }
   // populate
   node->statement->while_loop->condition = e;
   node->statement->while_loop->body = body->statement;
-  // free container for body statement
-  free( body );
-  // reset in loop statement
+  // reset in loop statement and decrease loop level
   parser->in_loop = false;
+  parser->loop_level--;
   // return
   return node;
 }
@@ -1000,21 +918,19 @@ static bosl_ast_node_t* statement_while( void ) {
  */
 static bosl_ast_node_t* statement_block( void ) {
   // allocate new ast node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_BLOCK );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_BLOCK );
   if ( !node->statement ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // construct list
-  node->statement->block->statements = list_construct(
-    NULL, list_statement_cleanup, NULL );
+  node->statement->block->statements = vector_construct_arena( parser->arena );
   if ( !node->statement->block->statements ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   while (
@@ -1023,23 +939,17 @@ static bosl_ast_node_t* statement_block( void ) {
     // evaluate
     bosl_ast_node_t* inner = declaration();
     if ( !inner ) {
-      bosl_ast_node_destroy( node );
       return NULL;
     }
-    if ( !list_push_back_data(
+    if ( !vector_push_back(
       node->statement->block->statements,
       inner->statement
     ) ) {
-      bosl_ast_node_destroy( node );
-      bosl_ast_node_destroy( inner );
       return NULL;
     }
-    // free container around statement
-    free( inner );
   }
   // expect closing brace
-  if ( !consume( TOKEN_RIGHT_BRACE, "Expect '}' after block." ) ) {
-    bosl_ast_node_destroy( node );
+  if ( !expect( TOKEN_RIGHT_BRACE, "Expect '}' after block." ) ) {
     return NULL;
   }
   // return node
@@ -1064,31 +974,85 @@ static bosl_ast_node_t* statement_pointer( void ) {
     return NULL;
   }
   // allocate new ast node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_POINTER );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_POINTER );
   if ( !node->statement ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate node
   node->statement->pointer->name = identifier;
   node->statement->pointer->statement = pointer_ast->statement;
-  free( pointer_ast );
   // return node
   return node;
 }
 
+/**
+ * @brief Helper to resolve literal break and continue levels
+ *
+ * @param token
+ * @param e
+ * @param level
+ * @return
+ *
+ * @note level is set to zero if it has to be evaluated at runtime
+ */
+static bool resolve_break_continue_level(
+  bosl_token_t* token,
+  bosl_ast_expression_t* e,
+  size_t* level
+) {
+  bool is_break = TOKEN_BREAK == token->type;
+  // default level is one
+  if ( !e ) {
+    *level = 1;
+    return true;
+  }
+  // anything else than a integer literal is evaluated at runtime
+  if (
+    EXPRESSION_LITERAL != e->type
+    || EXPRESSION_LITERAL_TYPE_NUMBER_INT != e->literal->type
+  ) {
+    *level = 0;
+    return true;
+  }
+  // extract literal
+  uint64_t value;
+  memcpy( &value, e->literal->value, sizeof( value ) );
+  // handle invalid level
+  if ( 0 == value ) {
+    bosl_error_raise(
+      token,
+      is_break
+        ? "Break level has to be positive."
+        : "Continue level has to be positive."
+    );
+    return false;
+  }
+  // handle more levels than loops are existing
+  if ( value > parser->loop_level ) {
+    bosl_error_raise(
+      token,
+      is_break ? "Break statement to high." : "Continue statement to high."
+    );
+    return false;
+  }
+  // set level
+  *level = ( size_t )value;
+  return true;
+}
+
 /**
  * @brief Handle break statement
  *
  * @return
  */
 static bosl_ast_node_t* statement_break( void ) {
-  if ( !parser->in_loop ) {
+  if ( !parser->loop_level ) {
     bosl_error_raise( parser->current(), "Break is only allowed in a loop" );
     return NULL;
   }
@@ -1103,24 +1067,29 @@ static bosl_ast_node_t* statement_break( void ) {
     }
   }
   // expect semicolon
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' at end of break." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' at end of break." ) ) {
+    return NULL;
+  }
+  // resolve literal level
+  size_t level;
+  if ( !resolve_break_continue_level( token, e, &level ) ) {
     return NULL;
   }
   // allocate new ast node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_BREAK );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_BREAK );
   if ( !node->statement ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate node
   node->statement->break_continue->token = token;
   node->statement->break_continue->level = e;
+  node->statement->break_continue->resolved_level = level;
   // return node
   return node;
 }
@@ -1131,7 +1100,7 @@ static bosl_ast_node_t* statement_break( void ) {
  * @return
  */
 static bosl_ast_node_t* statement_continue( void ) {
-  if ( !parser->in_loop ) {
+  if ( !parser->loop_level ) {
     bosl_error_raise( parser->current(), "Continue is only allowed in a loop." );
     return NULL;
   }
@@ -1146,24 +1115,29 @@ static bosl_ast_node_t* statement_continue( void ) {
     }
   }
   // expect semicolon
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' at end of continue." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' at end of continue." ) ) {
+    return NULL;
+  }
+  // resolve literal level
+  size_t level;
+  if ( !resolve_break_continue_level( token, e, &level ) ) {
     return NULL;
   }
   // allocate new ast node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
     return NULL;
   }
   // allocate new ast node
-  node->statement = bosl_ast_statement_allocate( STATEMENT_CONTINUE );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_CONTINUE );
   if ( !node->statement ) {
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate node
   node->statement->break_continue->token = token;
   node->statement->break_continue->level = e;
+  node->statement->break_continue->resolved_level = level;
   // return node
   return node;
 }
@@ -1180,21 +1154,18 @@ static bosl_ast_node_t* statement_expression( void ) {
     return NULL;
   }
   // check for trailing semicolon
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' after expression." ) ) {
-    bosl_ast_expression_destroy( e );
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' after expression." ) ) {
     return NULL;
   }
   // allocate new ast node
-  bosl_ast_node_t* new_node = bosl_ast_node_allocate();
+  bosl_ast_node_t* new_node = bosl_ast_node_allocate( parser->arena );
   if ( !new_node ) {
-    bosl_ast_expression_destroy( e );
     return NULL;
   }
   // allocate new ast node
-  new_node->statement = bosl_ast_statement_allocate( STATEMENT_EXPRESSION );
+  new_node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_EXPRESSION );
   if ( !new_node->statement ) {
-    bosl_ast_expression_destroy( e );
-    bosl_ast_node_destroy( new_node );
     return NULL;
   }
   // get pointer to data
@@ -1248,7 +1219,7 @@ static bosl_ast_node_t* declaration_const( void ) {
   if ( !name ) {
     return NULL;
   }
-  if ( !consume( TOKEN_COLON, "Expect colon after variable name." ) ) {
+  if ( !expect( TOKEN_COLON, "Expect colon after variable name." ) ) {
     return NULL;
   }
   // get type identifier
@@ -1268,21 +1239,18 @@ static bosl_ast_node_t* declaration_const( void ) {
     return NULL;
   }
   // assert semicolon at the end
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' after variable declaration." ) ) {
-    bosl_ast_expression_destroy( initializer );
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' after variable declaration." ) ) {
     return NULL;
   }
   // allocate node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    bosl_ast_expression_destroy( initializer );
     return NULL;
   }
   // allocate statement
-  node->statement = bosl_ast_statement_allocate( STATEMENT_CONST );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_CONST );
   if ( !node->statement ) {
-    bosl_ast_expression_destroy( initializer );
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate
@@ -1305,7 +1273,7 @@ static bosl_ast_node_t* declaration_let( void ) {
   if ( !name ) {
     return NULL;
   }
-  if ( !consume( TOKEN_COLON, "Expect colon after variable name." ) ) {
+  if ( !expect( TOKEN_COLON, "Expect colon after variable name." ) ) {
     return NULL;
   }
   // get type identifier
@@ -1320,27 +1288,18 @@ static bosl_ast_node_t* declaration_let( void ) {
     initializer = expression();
   }
   // assert semicolon at the end
-  if ( !consume( TOKEN_SEMICOLON, "Expect ';' after variable declaration." ) ) {
-    if ( initializer ) {
-      bosl_ast_expression_destroy( initializer );
-    }
+  if ( !expect( TOKEN_SEMICOLON, "Expect ';' after variable declaration." ) ) {
     return NULL;
   }
   // allocate node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    if ( initializer ) {
-      bosl_ast_expression_destroy( initializer );
-    }
     return NULL;
   }
   // allocate statement
-  node->statement = bosl_ast_statement_allocate( STATEMENT_VARIABLE );
+  node->statement = bosl_ast_statement_allocate(
+    parser->arena, STATEMENT_VARIABLE );
   if ( !node->statement ) {
-    if ( initializer ) {
-      bosl_ast_expression_destroy( initializer );
-    }
-    bosl_ast_node_destroy( node );
     return NULL;
   }
   // populate
@@ -1371,14 +1330,12 @@ static bosl_ast_node_t* declaration_function( void ) {
     return NULL;
   }
   // create parameter list
-  list_manager_t* parameter = list_construct(
-    NULL, list_statement_cleanup, NULL );
+  vector_t* parameter = vector_construct_arena( parser->arena );
   if ( !parameter ) {
     return NULL;
   }
   // expect opening parenthesis
-  if ( !consume( TOKEN_LEFT_PARENTHESIS, "Expect '(' after function name." ) ) {
-    list_destruct( parameter );
+  if ( !expect( TOKEN_LEFT_PARENTHESIS, "Expect '(' after function name." ) ) {
     return NULL;
   }
   // get current token
@@ -1391,12 +1348,10 @@ static bosl_ast_node_t* declaration_function( void ) {
         TOKEN_IDENTIFIER, "Expect parameter name." );
       // expect parameter name
       if ( !parameter_name ) {
-        list_destruct( parameter );
         return NULL;
       }
       // expect colon
-      if ( !consume( TOKEN_COLON, "Expect colon after parameter name." ) ) {
-        list_destruct( parameter );
+      if ( !expect( TOKEN_COLON, "Expect colon after parameter name." ) ) {
         return NULL;
       }
       // cache parameter type
@@ -1404,35 +1359,29 @@ static bosl_ast_node_t* declaration_function( void ) {
         TOKEN_TYPE_IDENTIFIER, "Expect type identifier after colon." );
       // expect type identifier
       if ( !parameter_type ) {
-        list_destruct( parameter );
         return NULL;
       }
       // build object to push
       bosl_ast_statement_t* p = bosl_ast_statement_allocate(
-        STATEMENT_PARAMETER );
+        parser->arena, STATEMENT_PARAMETER );
       if ( !p ) {
-        list_destruct( parameter );
         return NULL;
       }
       // populate
       p->parameter->name = parameter_name;
       p->parameter->type = parameter_type;
       // push back
-      if ( !list_push_back_data( parameter, p ) ) {
-        bosl_ast_statement_destroy( p );
-        list_destruct( parameter );
+      if ( !vector_push_back( parameter, p ) ) {
         return NULL;
       }
     } while ( match( TOKEN_COMMA ) );
   }
   // check for closing parenthesis
-  if ( !consume( TOKEN_RIGHT_PARENTHESIS, "Expected ')' after arguments." ) ) {
-    list_destruct( parameter );
+  if ( !expect( TOKEN_RIGHT_PARENTHESIS, "Expected ')' after arguments." ) ) {
     return NULL;
   }
   // expect colon
-  if ( !consume( TOKEN_COLON, "Expect colon after closing parenthesis." ) ) {
-    list_destruct( parameter );
+  if ( !expect( TOKEN_COLON, "Expect colon after closing parenthesis." ) ) {
     return NULL;
   }
   // cache return type
@@ -1440,71 +1389,54 @@ static bosl_ast_node_t* declaration_function( void ) {
     TOKEN_TYPE_IDENTIFIER, "Expect return type identifier." );
   // expect type identifier
   if ( !return_type ) {
-    list_destruct( parameter );
     return NULL;
   }
   // check opening brace
-  if ( !consume( TOKEN_LEFT_BRACE, "Expected '{' before body." ) ) {
-    list_destruct( parameter );
+  if ( !expect( TOKEN_LEFT_BRACE, "Expected '{' before body." ) ) {
     return NULL;
   }
   // build object to push
   bosl_ast_statement_t* f = bosl_ast_statement_allocate(
-    STATEMENT_FUNCTION );
+    parser->arena, STATEMENT_FUNCTION );
   if ( !f ) {
-    list_destruct( parameter );
     return NULL;
   }
   // create block for body
   bosl_ast_node_t* body = statement_block();
   if ( !body ) {
-    list_destruct( parameter );
-    bosl_ast_statement_destroy( f );
     return NULL;
   }
   // handle possible load
   if ( match( TOKEN_EQUAL ) ) {
-    // destroy body again
-    bosl_ast_node_destroy( body );
     // after equal a load has to come
-    if ( !consume( TOKEN_LOAD, "Expect load type after equal." ) ) {
-      list_destruct( parameter );
-      bosl_ast_statement_destroy( f );
+    if ( !expect( TOKEN_LOAD, "Expect load type after equal." ) ) {
       return NULL;
     }
     // consume fn tag
-    if ( !consume( TOKEN_FUNCTION, "Expect fn after load." ) ) {
-      list_destruct( parameter );
-      bosl_ast_statement_destroy( f );
+    if ( !expect( TOKEN_FUNCTION, "Expect fn after load." ) ) {
       return NULL;
     }
     // set load identifier
     f->function->load_identifier = consume(
       TOKEN_IDENTIFIER, "Expect identifier after load." );
     if ( !f->function->load_identifier ) {
-      list_destruct( parameter );
-      bosl_ast_statement_destroy( f );
       return NULL;
     }
     // consume semicolon
-    if ( !consume( TOKEN_SEMICOLON, "Expect ';' after load identifier." ) ) {
-      list_destruct( parameter );
-      bosl_ast_statement_destroy( f );
+    if ( !expect( TOKEN_SEMICOLON, "Expect ';' after load identifier." ) ) {
       return NULL;
     }
   } else {
     // set body
     f->function->body = body->statement;
-    free( body );
   }
   // populate rest of stuff
   f->function->token = name;
   f->function->parameter = parameter;
   f->function->return_type = return_type;
   // allocate node
-  bosl_ast_node_t* node = bosl_ast_node_allocate();
+  bosl_ast_node_t* node = bosl_ast_node_allocate( parser->arena );
   if ( !node ) {
-    bosl_ast_statement_destroy( f );
     return NULL;
   }
   // populate node
@@ -1540,12 +1472,11 @@ static bosl_ast_node_t* declaration( void ) {
 }
 
 /**
- * @brief Setup parser
+ * @brief Setup parser pulling token from initialized scanner
  *
- * @param token
  * @return
  */
-bool bosl_parser_init( list_manager_t* token ) {
+bool bosl_parser_init( void ) {
   // handle already initialized
   if ( parser ) {
     return true;
@@ -1557,17 +1488,25 @@ bool bosl_parser_init( list_manager_t* token ) {
   }
   // clear out
   memset( parser, 0, sizeof( bosl_parser_t ) );
+  // construct arena holding the whole ast
+  parser->arena = arena_construct();
+  if ( !parser->arena ) {
+    free( parser );
+    return false;
+  }
   // construct ast list
-  parser->ast = list_construct( NULL, list_node_cleanup, NULL );
+  parser->ast = vector_construct_arena( parser->arena );
   if ( !parser->ast ) {
+    arena_destruct( parser->arena );
     free( parser );
     return false;
   }
-  // push in token list and set current to first element
-  parser->token = token;
-  parser->current_item = token->first;
+  // token are pulled from scanner on demand
+  parser->previous_token = NULL;
+  parser->previous_retained = NULL;
   parser->in_function = false;
   parser->in_loop = false;
+  parser->loop_level = 0;
   parser->depth = 0;
   // push back convenience helper
   parser->current = current;
@@ -1585,10 +1524,8 @@ void bosl_parser_free( void ) {
   if ( !parser ) {
     return;
   }
-  // free ast
-  if ( parser->ast ) {
-    list_destruct( parser->ast );
-  }
+  // free ast at once
+  arena_destruct( parser->arena );
   // just free structure
   free( parser );
 }
@@ -1598,13 +1535,13 @@ void bosl_parser_free( void ) {
  *
  * @return
  */
-list_manager_t* bosl_parser_scan( void ) {
+vector_t* bosl_parser_scan( void ) {
   // handle not initialized
   if ( !parser ) {
     return NULL;
   }
   // loop until end
-  while ( parser->current_item && TOKEN_EOF != parser->current()->type ) {
+  while ( TOKEN_EOF != parser->current()->type ) {
     // handle eof by break
     bosl_token_t* token = parser->current();
     if ( TOKEN_EOF == token->type ) {
@@ -1619,13 +1556,11 @@ list_manager_t* bosl_parser_scan( void ) {
       return NULL;
     }
     // add to list
-    if ( !list_push_back_data( parser->ast, tmp ) ) {
+    if ( !vector_push_back( parser->ast, tmp ) ) {
       bosl_error_raise(
         parser->current(),
         "Unable to push back ast node!"
       );
-      // destroy node
-      bosl_ast_node_destroy( tmp );
       // return null
       return NULL;
     }
@@ -1679,8 +1614,8 @@ static void print_expression( bosl_ast_expression_t* e ) {
       print_expression( e->call->callee );
       fprintf( stdout, " " );
       // print parameter
-      for ( list_item_t* c = e->call->arguments->first; c; c = c->next ) {
-        print_expression( c->data );
+      for ( size_t c = 0; c < vector_size( e->call->arguments ); c++ ) {
+        print_expression( vector_at( e->call->arguments, c ) );
       }
       // closing block
       fprintf( stdout, ")" );
@@ -1813,11 +1748,11 @@ static void print_statement( bosl_ast_statement_t* s ) {
         s->function->token->start
       );
       // print parameter
-      for ( list_item_t* c = s->function->parameter->first; c; c = c->next ) {
-        if ( c != s->function->parameter->first ) {
+      for ( size_t c = 0; c < vector_size( s->function->parameter ); c++ ) {
+        if ( c ) {
           fprintf( stdout, " " );
         }
-        bosl_ast_statement_t* p = c->data;
+        bosl_ast_statement_t* p = vector_at( s->function->parameter, c );
         fprintf(
           stdout, "%*.*s:%*.*s",
           ( int )p->parameter->name->length, ( int )p->parameter->name->length,
@@ -1985,11 +1920,11 @@ static void print_statement( bosl_ast_statement_t* s ) {
       // opening block
       fprintf( stdout, "(block " );
       // print all inner statements
-      for ( list_item_t* c = s->block->statements->first; c; c = c->next ) {
-        if ( c != s->block->statements->first ) {
+      for ( size_t c = 0; c < vector_size( s->block->statements ); c++ ) {
+        if ( c ) {
           fprintf( stdout, " " );
         }
-        print_statement( c->data );
+        print_statement( vector_at( s->block->statements, c ) );
       }
       // closing block
       fprintf( stdout, ")" );
@@ -2045,15 +1980,12 @@ void bosl_parser_print( void ) {
   if ( !parser ) {
     return;
   }
-  list_item_t* current_item = parser->ast->first;
   // loop through nodes and print them
-  while ( current_item ) {
+  for ( size_t index = 0; index < vector_size( parser->ast ); index++ ) {
     // initialize depth
     parser->depth = 0;
     // print node
-    print_node( current_item->data );
-    // get to next
-    current_item = current_item->next;
+    print_node( vector_at( parser->ast, index ) );
   }
   // final newline
   fprintf( stdout, "\r\n" );
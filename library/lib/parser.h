@@ -20,10 +20,12 @@
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/list.h"
+  #include "collection/arena.h"
+  #include "collection/vector.h"
   #include "scanner.h"
 #else
-  #include <bosl/collection/list.h>
+  #include <bosl/collection/arena.h>
+  #include <bosl/collection/vector.h>
   #include <bosl/scanner.h>
 #endif
 
@@ -43,18 +45,20 @@ typedef struct {
   parser_current_t current;
   parser_next_t next;
 
-  list_manager_t* ast;
-  list_manager_t* token;
-  list_item_t* current_item;
+  arena_t* arena; // owns all ast nodes, lists and literals
+  vector_t* ast;
+  bosl_token_t* previous_token;
+  bosl_token_t* previous_retained;
 
   bool in_function;
   bool in_loop;
+  size_t loop_level;
   size_t depth;
 } bosl_parser_t;
 
-bool bosl_parser_init( list_manager_t* );
+bool bosl_parser_init( void );
 void bosl_parser_free( void );
-list_manager_t* bosl_parser_scan( void );
+vector_t* bosl_parser_scan( void );
 void bosl_parser_print( void );
 
 #ifdef __cplusplus
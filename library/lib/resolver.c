@@ -0,0 +1,438 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "ast/common.h"
+#include "ast/expression.h"
+#include "ast/statement.h"
+#include "resolver.h"
+#include "environment.h"
+#include "collection/pool.h"
+#include "error.h"
+
+// necessary forward declarations
+static bool resolve_expression( bosl_ast_expression_t* );
+static bool resolve_statement( bosl_ast_statement_t* );
+
+static bosl_resolver_t* resolver = NULL;
+
+/**
+ * @brief Helper to open a new scope
+ *
+ * @return
+ */
+static bool scope_push( void ) {
+  // allocate scope
+  bosl_resolver_scope_t* scope = pool_allocate( sizeof( bosl_resolver_scope_t ) );
+  if ( !scope ) {
+    bosl_error_raise( NULL, "Unable to allocate resolver scope." );
+    return false;
+  }
+  // clear out
+  memset( scope, 0, sizeof( bosl_resolver_scope_t ) );
+  // start with inline slots
+  scope->slot = scope->inline_slot;
+  scope->slot_capacity = BOSL_RESOLVER_INLINE_SLOT;
+  // link scope
+  scope->enclosing = resolver->scope;
+  resolver->scope = scope;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to close current scope
+ *
+ * @return amount of slots used by the scope
+ */
+static size_t scope_pop( void ) {
+  // get scope and unlink it
+  bosl_resolver_scope_t* scope = resolver->scope;
+  resolver->scope = scope->enclosing;
+  // save slot count
+  size_t slot_count = scope->slot_count;
+  // free scope
+  if ( scope->slot != scope->inline_slot ) {
+    free( scope->slot );
+  }
+  if ( scope->index ) {
+    hashmap_destruct( scope->index );
+  }
+  pool_free( scope, sizeof( bosl_resolver_scope_t ) );
+  // return slot count
+  return slot_count;
+}
+
+/**
+ * @brief Helper to find slot of an atom within a scope
+ *
+ * @param scope
+ * @param atom
+ * @param slot
+ * @return
+ */
+static bool scope_find(
+  bosl_resolver_scope_t* scope,
+  bosl_atom_t atom,
+  size_t* slot
+) {
+  // use index of large scopes
+  if ( scope->index ) {
+    uintptr_t found = ( uintptr_t )hashmap_value_get_n(
+      scope->index, ( const char* )&atom, sizeof( atom ) );
+    if ( !found ) {
+      return false;
+    }
+    *slot = ( size_t )found - 1;
+    return true;
+  }
+  // compare atoms, names are interned
+  for ( size_t index = 0; index < scope->slot_count; index++ ) {
+    if ( atom == scope->slot[ index ] ) {
+      *slot = index;
+      return true;
+    }
+  }
+  // not found
+  return false;
+}
+
+/**
+ * @brief Helper to add a slot to the index of a scope
+ *
+ * @param scope
+ * @param slot
+ * @return
+ */
+static bool index_slot( bosl_resolver_scope_t* scope, size_t slot ) {
+  return hashmap_value_set_n(
+    scope->index,
+    ( const char* )&scope->slot[ slot ],
+    ( void* )( uintptr_t )( slot + 1 ),
+    sizeof( bosl_atom_t )
+  );
+}
+
+/**
+ * @brief Helper to declare a name within current scope
+ *
+ * @param name
+ * @param slot
+ * @return
+ */
+static bool declare( bosl_token_t* name, size_t* slot ) {
+  bosl_resolver_scope_t* scope = resolver->scope;
+  // redeclaration reuses the existing slot
+  if ( scope_find( scope, name->atom, slot ) ) {
+    return true;
+  }
+  // enlarge slots if necessary
+  if ( scope->slot_count >= scope->slot_capacity ) {
+    size_t capacity = scope->slot_capacity * 2;
+    bosl_atom_t* atom = scope->slot == scope->inline_slot
+      ? malloc( sizeof( bosl_atom_t ) * capacity )
+      : realloc( scope->slot, sizeof( bosl_atom_t ) * capacity );
+    if ( !atom ) {
+      bosl_error_raise( name, "Unable to declare name in resolver scope." );
+      return false;
+    }
+    // move inline slots
+    if ( scope->slot == scope->inline_slot ) {
+      memcpy( atom, scope->inline_slot, sizeof( scope->inline_slot ) );
+    }
+    scope->slot = atom;
+    scope->slot_capacity = capacity;
+  }
+  // add new slot, set slot and increment count
+  scope->slot[ scope->slot_count ] = name->atom;
+  *slot = scope->slot_count++;
+  // build index when crossing threshold
+  if ( !scope->index && BOSL_RESOLVER_INDEX_THRESHOLD <= scope->slot_count ) {
+    scope->index = hashmap_construct( NULL );
+    if ( !scope->index ) {
+      bosl_error_raise( name, "Unable to declare name in resolver scope." );
+      return false;
+    }
+    // add all existing slots
+    for ( size_t index = 0; index < scope->slot_count - 1; index++ ) {
+      if ( !index_slot( scope, index ) ) {
+        bosl_error_raise( name, "Unable to declare name in resolver scope." );
+        return false;
+      }
+    }
+  }
+  // add slot to index
+  if ( scope->index && !index_slot( scope, *slot ) ) {
+    bosl_error_raise( name, "Unable to declare name in resolver scope." );
+    return false;
+  }
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to resolve a name to depth and slot
+ *
+ * @param name
+ * @param depth
+ * @param slot
+ */
+static void resolve_name( bosl_token_t* name, size_t* depth, size_t* slot ) {
+  size_t current_depth = 0;
+  // loop through scopes from inner to outer
+  for (
+    bosl_resolver_scope_t* scope = resolver->scope;
+    scope;
+    scope = scope->enclosing, current_depth++
+  ) {
+    if ( scope_find( scope, name->atom, slot ) ) {
+      *depth = current_depth;
+      return;
+    }
+  }
+  // unresolved names raise an error at runtime
+  *depth = BOSL_ENVIRONMENT_UNRESOLVED;
+  *slot = 0;
+}
+
+/**
+ * @brief Resolve an expression
+ *
+ * @param e
+ * @return
+ */
+static bool resolve_expression( bosl_ast_expression_t* e ) {
+  switch ( e->type ) {
+    case EXPRESSION_ASSIGN:
+      // resolve value first
+      if ( !resolve_expression( e->assign->value ) ) {
+        return false;
+      }
+      // resolve target
+      resolve_name( e->assign->token, &e->assign->depth, &e->assign->slot );
+      return true;
+    case EXPRESSION_BINARY:
+      return resolve_expression( e->binary->left )
+        && resolve_expression( e->binary->right );
+    case EXPRESSION_CALL: {
+      // resolve callee
+      if ( !resolve_expression( e->call->callee ) ) {
+        return false;
+      }
+      // resolve arguments
+      for ( size_t index = 0; index < vector_size( e->call->arguments ); index++ ) {
+        if ( !resolve_expression( vector_at( e->call->arguments, index ) ) ) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case EXPRESSION_GROUPING:
+      return resolve_expression( e->grouping->expression );
+    case EXPRESSION_LOGICAL:
+      return resolve_expression( e->logical->left )
+        && resolve_expression( e->logical->right );
+    case EXPRESSION_UNARY:
+      return resolve_expression( e->unary->right );
+    case EXPRESSION_VARIABLE:
+      resolve_name( e->variable->name, &e->variable->depth, &e->variable->slot );
+      return true;
+    case EXPRESSION_LITERAL:
+    case EXPRESSION_LOAD:
+    case EXPRESSION_POINTER:
+      return true;
+  }
+  bosl_error_raise( NULL, "Unknown expression." );
+  return false;
+}
+
+/**
+ * @brief Resolve a block
+ *
+ * @param b
+ * @return
+ */
+static bool resolve_block( bosl_ast_statement_block_t* b ) {
+  // open scope
+  if ( !scope_push() ) {
+    return false;
+  }
+  // resolve statement per statement
+  bool result = true;
+  for ( size_t index = 0; result && index < vector_size( b->statements ); index++ ) {
+    result = resolve_statement( vector_at( b->statements, index ) );
+  }
+  // close scope and save amount of slots
+  b->slot_count = scope_pop();
+  return result;
+}
+
+/**
+ * @brief Resolve a function
+ *
+ * @param f
+ * @return
+ */
+static bool resolve_function( bosl_ast_statement_function_t* f ) {
+  // declare function name before body to allow recursion
+  if ( !declare( f->token, &f->slot ) ) {
+    return false;
+  }
+  // open parameter scope
+  if ( !scope_push() ) {
+    return false;
+  }
+  // declare parameter in order
+  bool result = true;
+  size_t count = f->parameter ? vector_size( f->parameter ) : 0;
+  for ( size_t index = 0; result && index < count; index++ ) {
+    bosl_ast_statement_t* parameter = vector_at( f->parameter, index );
+    result = declare( parameter->parameter->name, &parameter->parameter->slot );
+  }
+  // resolve body
+  if ( result && f->body ) {
+    result = resolve_statement( f->body );
+  }
+  // close scope and save amount of slots
+  f->slot_count = scope_pop();
+  return result;
+}
+
+/**
+ * @brief Resolve a statement
+ *
+ * @param s
+ * @return
+ */
+static bool resolve_statement( bosl_ast_statement_t* s ) {
+  switch ( s->type ) {
+    case STATEMENT_BLOCK:
+      return resolve_block( s->block );
+    case STATEMENT_EXPRESSION:
+      return resolve_expression( s->expression->expression );
+    case STATEMENT_PARAMETER:
+      bosl_error_raise(
+        s->parameter->name,
+        "Parameter statement is standalone not possible."
+      );
+      return false;
+    case STATEMENT_FUNCTION:
+      return resolve_function( s->function );
+    case STATEMENT_IF:
+      return resolve_expression( s->if_else->if_condition )
+        && resolve_statement( s->if_else->if_statement )
+        && (
+          !s->if_else->else_statement
+          || resolve_statement( s->if_else->else_statement )
+        );
+    case STATEMENT_PRINT:
+      return resolve_expression( s->print->expression );
+    case STATEMENT_RETURN:
+      return !s->return_value->value
+        || resolve_expression( s->return_value->value );
+    case STATEMENT_VARIABLE:
+      // initializer is resolved before the name is declared
+      return (
+        !s->variable->initializer
+        || resolve_expression( s->variable->initializer )
+      ) && declare( s->variable->name, &s->variable->slot );
+    case STATEMENT_CONST:
+      return resolve_expression( s->constant->initializer )
+        && declare( s->constant->name, &s->constant->slot );
+    case STATEMENT_WHILE:
+      return resolve_expression( s->while_loop->condition )
+        && resolve_statement( s->while_loop->body );
+    case STATEMENT_BREAK:
+    case STATEMENT_CONTINUE:
+      return !s->break_continue->level
+        || resolve_expression( s->break_continue->level );
+    case STATEMENT_POINTER:
+      return true;
+  }
+  bosl_error_raise( NULL, "Unknown ast statement" );
+  return false;
+}
+
+/**
+ * @brief Helper to declare top level names ahead
+ *
+ * @param s
+ * @return
+ */
+static bool declare_ahead( bosl_ast_statement_t* s ) {
+  switch ( s->type ) {
+    case STATEMENT_FUNCTION:
+      return declare( s->function->token, &s->function->slot );
+    case STATEMENT_VARIABLE:
+      return declare( s->variable->name, &s->variable->slot );
+    case STATEMENT_CONST:
+      return declare( s->constant->name, &s->constant->slot );
+    default:
+      return true;
+  }
+}
+
+/**
+ * @brief Resolve variable references of an ast to environment slots
+ *
+ * @param ast
+ * @param global_slots
+ * @return
+ */
+bool bosl_resolver_resolve( vector_t* ast, size_t* global_slots ) {
+  // allocate resolver structure
+  resolver = malloc( sizeof( bosl_resolver_t ) );
+  if ( !resolver ) {
+    return false;
+  }
+  // clear out
+  memset( resolver, 0, sizeof( bosl_resolver_t ) );
+  // open global scope
+  if ( !scope_push() ) {
+    free( resolver );
+    resolver = NULL;
+    return false;
+  }
+  // top level names are visible to functions declared before them
+  bool result = true;
+  for ( size_t index = 0; result && index < vector_size( ast ); index++ ) {
+    bosl_ast_node_t* node = vector_at( ast, index );
+    // handle no statement
+    if ( !node->statement ) {
+      bosl_error_raise( NULL, "Invalid ast node" );
+      result = false;
+      break;
+    }
+    result = declare_ahead( node->statement );
+  }
+  // resolve node per node
+  for ( size_t index = 0; result && index < vector_size( ast ); index++ ) {
+    bosl_ast_node_t* node = vector_at( ast, index );
+    result = resolve_statement( node->statement );
+  }
+  // close global scope and save amount of slots
+  *global_slots = scope_pop();
+  // free resolver
+  free( resolver );
+  resolver = NULL;
+  // return result
+  return result;
+}
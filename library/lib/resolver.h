@@ -0,0 +1,66 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "collection/vector.h"
+  #include "collection/hashmap.h"
+  #include "atom.h"
+#else
+  #include <bosl/collection/vector.h>
+  #include <bosl/collection/hashmap.h>
+  #include <bosl/atom.h>
+#endif
+
+#if !defined( BOSL_RESOLVER_H )
+#define BOSL_RESOLVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// amount of slots stored inline within a scope
+#define BOSL_RESOLVER_INLINE_SLOT 8
+// amount of slots from which on a hashmap is used for lookups
+#define BOSL_RESOLVER_INDEX_THRESHOLD 32
+
+typedef struct bosl_resolver_scope bosl_resolver_scope_t;
+
+typedef struct bosl_resolver_scope {
+  bosl_resolver_scope_t* enclosing;
+  bosl_atom_t* slot; // atom per slot index
+  size_t slot_count;
+  size_t slot_capacity;
+  hashmap_table_t* index; // atom to slot index + 1 for large scopes
+  bosl_atom_t inline_slot[ BOSL_RESOLVER_INLINE_SLOT ];
+} bosl_resolver_scope_t;
+
+typedef struct {
+  bosl_resolver_scope_t* scope;
+} bosl_resolver_t;
+
+bool bosl_resolver_resolve( vector_t*, size_t* );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,31 +20,451 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include "scanner.h"
 
-static bosl_scanner_t* scanner = NULL;
+#if defined( __AVX2__ )
+  #include <immintrin.h>
+  // one bit per character within match mask
+  #define SCANNER_BLOCK_WIDTH 32
+  #define SCANNER_BLOCK_SHIFT 0
+#elif defined( __SSE2__ )
+  #include <emmintrin.h>
+  // one bit per character within match mask
+  #define SCANNER_BLOCK_WIDTH 16
+  #define SCANNER_BLOCK_SHIFT 0
+#elif defined( __ARM_NEON )
+  #include <arm_neon.h>
+  // four bits per character within match mask
+  #define SCANNER_BLOCK_WIDTH 16
+  #define SCANNER_BLOCK_SHIFT 2
+#endif
+
+#if defined( SCANNER_PARALLEL )
+  #include <pthread.h>
+  #include <unistd.h>
+  // upper limit of chunks scanned in parallel
+  #define SCANNER_PARALLEL_CHUNK_MAX 16
+  // minimum amount of source per chunk
+  #define SCANNER_PARALLEL_CHUNK_MIN ( 256 * 1024 )
+#endif
+
+#if defined( SCANNER_PARALLEL )
+  // chunk workers scan with an own instance
+  static _Thread_local bosl_scanner_t* scanner = NULL;
+#else
+  static bosl_scanner_t* scanner = NULL;
+#endif
 
 /**
- * @brief Push current to next character and return previous
+ * @brief Helper to compare identifier with keyword
+ *
+ * @param start
+ * @param keyword
+ * @param length
+ * @param type
+ * @return type on match, TOKEN_IDENTIFIER otherwise
+ */
+static bosl_token_type_t keyword_match(
+  const char* start,
+  const char* keyword,
+  size_t length,
+  bosl_token_type_t type
+) {
+  return memcmp( start, keyword, length ) ? TOKEN_IDENTIFIER : type;
+}
+
+/**
+ * @brief Classify identifier as keyword
  *
+ * @param start
+ * @param length
+ * @return keyword token type or TOKEN_IDENTIFIER
+ *
+ * @note perfect hash on length and leading characters, so every identifier
+ * is compared with one keyword at most
+ */
+static bosl_token_type_t keyword_type( const char* start, size_t length ) {
+  switch ( length ) {
+    case 2:
+      switch ( start[ 0 ] ) {
+        case 'f':
+          return keyword_match( start, "fn", 2, TOKEN_FUNCTION );
+        case 'i':
+          return keyword_match( start, "if", 2, TOKEN_IF );
+      }
+      break;
+    case 3:
+      return keyword_match( start, "let", 3, TOKEN_LET );
+    case 4:
+      switch ( start[ 0 ] ) {
+        case 'b':
+          return keyword_match( start, "bool", 4, TOKEN_TYPE_IDENTIFIER );
+        case 'e':
+          return keyword_match( start, "else", 4, TOKEN_ELSE );
+        case 'i':
+          return keyword_match( start, "int8", 4, TOKEN_TYPE_IDENTIFIER );
+        case 'l':
+          return keyword_match( start, "load", 4, TOKEN_LOAD );
+        case 'n':
+          return keyword_match( start, "null", 4, TOKEN_NULL );
+        case 't':
+          return keyword_match( start, "true", 4, TOKEN_TRUE );
+        case 'v':
+          return keyword_match( start, "void", 4, TOKEN_TYPE_IDENTIFIER );
+      }
+      break;
+    case 5:
+      switch ( start[ 0 ] ) {
+        case 'b':
+          return keyword_match( start, "break", 5, TOKEN_BREAK );
+        case 'c':
+          return keyword_match( start, "const", 5, TOKEN_CONST );
+        case 'f':
+          return 'a' == start[ 1 ]
+            ? keyword_match( start, "false", 5, TOKEN_FALSE )
+            : keyword_match( start, "float", 5, TOKEN_TYPE_IDENTIFIER );
+        case 'i':
+          switch ( start[ 3 ] ) {
+            case '1':
+              return keyword_match( start, "int16", 5, TOKEN_TYPE_IDENTIFIER );
+            case '3':
+              return keyword_match( start, "int32", 5, TOKEN_TYPE_IDENTIFIER );
+            case '6':
+              return keyword_match( start, "int64", 5, TOKEN_TYPE_IDENTIFIER );
+          }
+          break;
+        case 'p':
+          return keyword_match( start, "print", 5, TOKEN_PRINT );
+        case 'u':
+          return keyword_match( start, "uint8", 5, TOKEN_TYPE_IDENTIFIER );
+        case 'w':
+          return keyword_match( start, "while", 5, TOKEN_WHILE );
+      }
+      break;
+    case 6:
+      switch ( start[ 0 ] ) {
+        case 'r':
+          return keyword_match( start, "return", 6, TOKEN_RETURN );
+        case 's':
+          return keyword_match( start, "string", 6, TOKEN_TYPE_IDENTIFIER );
+        case 'u':
+          switch ( start[ 4 ] ) {
+            case '1':
+              return keyword_match( start, "uint16", 6, TOKEN_TYPE_IDENTIFIER );
+            case '3':
+              return keyword_match( start, "uint32", 6, TOKEN_TYPE_IDENTIFIER );
+            case '6':
+              return keyword_match( start, "uint64", 6, TOKEN_TYPE_IDENTIFIER );
+          }
+          break;
+      }
+      break;
+    case 7:
+      return keyword_match( start, "pointer", 7, TOKEN_POINTER );
+    case 8:
+      return keyword_match( start, "continue", 8, TOKEN_CONTINUE );
+  }
+  return TOKEN_IDENTIFIER;
+}
+
+/**
+ * @brief Character classes used by the scanner automaton
+ */
+typedef enum {
+  CLASS_OTHER = 0,
+  CLASS_SPACE,
+  CLASS_NEWLINE,
+  CLASS_DIGIT,
+  CLASS_HEX_PREFIX,
+  CLASS_ALPHA,
+  CLASS_UNDERSCORE,
+  CLASS_DOT,
+  CLASS_COUNT,
+} scanner_class_t;
+
+/**
+ * @brief States of the scanner automaton
+ */
+typedef enum {
+  STATE_STOP = 0,
+  STATE_START,
+  STATE_IDENTIFIER,
+  STATE_NUMBER,
+  STATE_NUMBER_DOT,
+  STATE_FLOAT,
+  STATE_NUMBER_HEX_PREFIX,
+  STATE_HEX,
+  STATE_COUNT,
+} scanner_state_t;
+
+#define O CLASS_OTHER
+#define S CLASS_SPACE
+#define N CLASS_NEWLINE
+#define D CLASS_DIGIT
+#define X CLASS_HEX_PREFIX
+#define A CLASS_ALPHA
+#define U CLASS_UNDERSCORE
+#define P CLASS_DOT
+
+/**
+ * @brief Character class per byte, everything beyond ascii is unknown
+ */
+static const uint8_t char_class[ 256 ] = {
+  O, O, O, O, O, O, O, O, O, S, N, O, O, S, O, O, // 0x00
+  O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, // 0x10
+  S, O, O, O, O, O, O, O, O, O, O, O, O, O, P, O, // 0x20
+  D, D, D, D, D, D, D, D, D, D, O, O, O, O, O, O, // 0x30
+  O, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, // 0x40
+  A, A, A, A, A, A, A, A, X, A, A, O, O, O, O, U, // 0x50
+  O, A, A, A, A, A, A, A, A, A, A, A, A, A, A, A, // 0x60
+  A, A, A, A, A, A, A, A, X, A, A, O, O, O, O, O, // 0x70
+};
+
+#undef O
+#undef S
+#undef N
+#undef D
+#undef X
+#undef A
+#undef U
+#undef P
+
+/**
+ * @brief Transition table of the scanner automaton
+ *
+ * @note covers identifier and number runs, everything else leaves
+ * the automaton in start state and is handled by scan_token
+ */
+static const uint8_t transition[ STATE_COUNT ][ CLASS_COUNT ] = {
+  [ STATE_START ] = {
+    [ CLASS_DIGIT ] = STATE_NUMBER,
+    [ CLASS_HEX_PREFIX ] = STATE_IDENTIFIER,
+    [ CLASS_ALPHA ] = STATE_IDENTIFIER,
+  },
+  [ STATE_IDENTIFIER ] = {
+    [ CLASS_DIGIT ] = STATE_IDENTIFIER,
+    [ CLASS_HEX_PREFIX ] = STATE_IDENTIFIER,
+    [ CLASS_ALPHA ] = STATE_IDENTIFIER,
+    [ CLASS_UNDERSCORE ] = STATE_IDENTIFIER,
+  },
+  [ STATE_NUMBER ] = {
+    [ CLASS_DIGIT ] = STATE_NUMBER,
+    [ CLASS_HEX_PREFIX ] = STATE_NUMBER_HEX_PREFIX,
+    [ CLASS_DOT ] = STATE_NUMBER_DOT,
+  },
+  [ STATE_NUMBER_DOT ] = {
+    [ CLASS_DIGIT ] = STATE_FLOAT,
+  },
+  [ STATE_FLOAT ] = {
+    [ CLASS_DIGIT ] = STATE_FLOAT,
+  },
+  [ STATE_NUMBER_HEX_PREFIX ] = {
+    [ CLASS_DIGIT ] = STATE_HEX,
+    [ CLASS_HEX_PREFIX ] = STATE_HEX,
+    [ CLASS_ALPHA ] = STATE_HEX,
+  },
+  [ STATE_HEX ] = {
+    [ CLASS_DIGIT ] = STATE_HEX,
+    [ CLASS_HEX_PREFIX ] = STATE_HEX,
+    [ CLASS_ALPHA ] = STATE_HEX,
+  },
+};
+
+#if defined( __AVX2__ )
+/**
+ * @brief Helper to get characters of a block equal to given one
+ *
+ * @param current
+ * @param character
  * @return
  */
-static char advance( void ) {
-  scanner->current++;
-  return scanner->current[ -1 ];
+static uint64_t block_match( const char* current, char character ) {
+  __m256i block = _mm256_loadu_si256( ( const __m256i* )current );
+  return ( uint32_t )_mm256_movemask_epi8(
+    _mm256_cmpeq_epi8( block, _mm256_set1_epi8( character ) ) );
+}
+
+/**
+ * @brief Helper to get characters of a block which are no whitespace
+ *
+ * @param current
+ * @return
+ */
+static uint64_t block_match_no_space( const char* current ) {
+  __m256i block = _mm256_loadu_si256( ( const __m256i* )current );
+  __m256i space = _mm256_or_si256(
+    _mm256_or_si256(
+      _mm256_cmpeq_epi8( block, _mm256_set1_epi8( ' ' ) ),
+      _mm256_cmpeq_epi8( block, _mm256_set1_epi8( '\t' ) ) ),
+    _mm256_or_si256(
+      _mm256_cmpeq_epi8( block, _mm256_set1_epi8( '\r' ) ),
+      _mm256_cmpeq_epi8( block, _mm256_set1_epi8( '\n' ) ) ) );
+  return ~( uint32_t )_mm256_movemask_epi8( space ) & UINT32_MAX;
+}
+#elif defined( __SSE2__ )
+/**
+ * @brief Helper to get characters of a block equal to given one
+ *
+ * @param current
+ * @param character
+ * @return
+ */
+static uint64_t block_match( const char* current, char character ) {
+  __m128i block = _mm_loadu_si128( ( const __m128i* )current );
+  return ( uint32_t )_mm_movemask_epi8(
+    _mm_cmpeq_epi8( block, _mm_set1_epi8( character ) ) );
+}
+
+/**
+ * @brief Helper to get characters of a block which are no whitespace
+ *
+ * @param current
+ * @return
+ */
+static uint64_t block_match_no_space( const char* current ) {
+  __m128i block = _mm_loadu_si128( ( const __m128i* )current );
+  __m128i space = _mm_or_si128(
+    _mm_or_si128(
+      _mm_cmpeq_epi8( block, _mm_set1_epi8( ' ' ) ),
+      _mm_cmpeq_epi8( block, _mm_set1_epi8( '\t' ) ) ),
+    _mm_or_si128(
+      _mm_cmpeq_epi8( block, _mm_set1_epi8( '\r' ) ),
+      _mm_cmpeq_epi8( block, _mm_set1_epi8( '\n' ) ) ) );
+  return ~( uint32_t )_mm_movemask_epi8( space ) & UINT16_MAX;
+}
+#elif defined( __ARM_NEON )
+/**
+ * @brief Helper to get mask with four bits per character out of compare result
+ *
+ * @param compare
+ * @return
+ */
+static uint64_t block_mask( uint8x16_t compare ) {
+  // narrow each byte to four bits
+  uint8x8_t narrowed = vshrn_n_u16( vreinterpretq_u16_u8( compare ), 4 );
+  // keep only one bit per character
+  return vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 )
+    & 0x8888888888888888ull;
+}
+
+/**
+ * @brief Helper to get characters of a block equal to given one
+ *
+ * @param current
+ * @param character
+ * @return
+ */
+static uint64_t block_match( const char* current, char character ) {
+  return block_mask( vceqq_u8(
+    vld1q_u8( ( const uint8_t* )current ), vdupq_n_u8( ( uint8_t )character ) ) );
 }
 
 /**
- * @brief Return next character without stepping to next
+ * @brief Helper to get characters of a block which are no whitespace
  *
+ * @param current
  * @return
  */
-static char next( void ) {
-  if ( '\0' == scanner->current[ 0 ] ) {
-    return '\0';
+static uint64_t block_match_no_space( const char* current ) {
+  uint8x16_t block = vld1q_u8( ( const uint8_t* )current );
+  uint8x16_t space = vorrq_u8(
+    vorrq_u8(
+      vceqq_u8( block, vdupq_n_u8( ' ' ) ),
+      vceqq_u8( block, vdupq_n_u8( '\t' ) ) ),
+    vorrq_u8(
+      vceqq_u8( block, vdupq_n_u8( '\r' ) ),
+      vceqq_u8( block, vdupq_n_u8( '\n' ) ) ) );
+  return block_mask( vmvnq_u8( space ) );
+}
+#endif
+
+/**
+ * @brief Skip characters until given one or end is reached
+ *
+ * @param current
+ * @param character
+ * @param line
+ * @return position of character or end of source
+ *
+ * @note line breaks on the way are added to line
+ */
+static const char* skip_until(
+  const char* current,
+  char character,
+  uint32_t* line
+) {
+  const char* end = scanner->end;
+#if defined( SCANNER_BLOCK_WIDTH )
+  // check whole blocks while available
+  while ( end - current >= SCANNER_BLOCK_WIDTH ) {
+    uint64_t found = block_match( current, character );
+    uint64_t newline = block_match( current, '\n' );
+    if ( found ) {
+      int bit = __builtin_ctzll( found );
+      // count only line breaks in front of found character
+      *line += ( uint32_t )__builtin_popcountll(
+        newline & ( ( UINT64_C( 1 ) << bit ) - 1 ) );
+      return current + ( bit >> SCANNER_BLOCK_SHIFT );
+    }
+    *line += ( uint32_t )__builtin_popcountll( newline );
+    current += SCANNER_BLOCK_WIDTH;
+  }
+#endif
+  // check remaining characters one by one
+  while ( current < end && character != *current ) {
+    *line += '\n' == *current;
+    current++;
+  }
+  return current;
+}
+
+/**
+ * @brief Skip whitespace and line breaks
+ *
+ * @param current
+ * @param line
+ * @return position of first non whitespace character or end of source
+ *
+ * @note line breaks on the way are added to line
+ */
+static const char* skip_space( const char* current, uint32_t* line ) {
+  const char* end = scanner->end;
+#if defined( SCANNER_BLOCK_WIDTH )
+  // check whole blocks while available
+  while ( end - current >= SCANNER_BLOCK_WIDTH ) {
+    uint64_t found = block_match_no_space( current );
+    uint64_t newline = block_match( current, '\n' );
+    if ( found ) {
+      int bit = __builtin_ctzll( found );
+      // count only line breaks in front of found character
+      *line += ( uint32_t )__builtin_popcountll(
+        newline & ( ( UINT64_C( 1 ) << bit ) - 1 ) );
+      return current + ( bit >> SCANNER_BLOCK_SHIFT );
+    }
+    *line += ( uint32_t )__builtin_popcountll( newline );
+    current += SCANNER_BLOCK_WIDTH;
+  }
+#endif
+  // check remaining characters one by one
+  while ( current < end ) {
+    uint8_t character_class = char_class[ ( unsigned char )*current ];
+    if ( CLASS_SPACE != character_class && CLASS_NEWLINE != character_class ) {
+      break;
+    }
+    *line += CLASS_NEWLINE == character_class;
+    current++;
   }
-  return scanner->current[ 1 ];
+  return current;
+}
+
+/**
+ * @brief Push current to next character and return previous
+ *
+ * @return
+ */
+static char advance( void ) {
+  scanner->current++;
+  return scanner->current[ -1 ];
 }
 
 /**
@@ -62,39 +482,30 @@ static bool match( char expected ) {
 }
 
 /**
- * @brief Helper to add token to list of tokens
+ * @brief Helper to add token to lookahead buffer
  *
  * @param type
  * @param message
- * @return
+ * @return added token
+ *
+ * @note message is expected to be a string literal and is not copied
  */
-static bool add_token(
+static bosl_token_t* add_token(
   bosl_token_type_t type,
   const char* message
 ) {
-  // handle not initialized
-  if ( !scanner->token ) {
-    return false;
-  }
-  // allocate token
-  bosl_token_t* token = malloc( sizeof( *token ) );
-  if ( !token ) {
-    return false;
-  }
+  // get free slot behind buffered tokens
+  bosl_token_t* token = &scanner->lookahead[
+    ( scanner->lookahead_head + scanner->lookahead_count )
+      % BOSL_SCANNER_LOOKAHEAD
+  ];
+  scanner->lookahead_count++;
   // clear out
   memset( token, 0, sizeof( *token ) );
   // populate start / message
   if ( message ) {
-    size_t len = strlen( message );
-    // allocate space for message
-    token->start = malloc( sizeof( char ) * ( len + 1 ) );
-    if ( !token->start ) {
-      free( token );
-      return false;
-    }
-    // copy message
-    strcpy( ( char* )token->start, message );
-    token->length = len;
+    token->start = message;
+    token->length = strlen( message );
   } else {
     token->start = scanner->start;
     token->length = ( size_t )( scanner->current - scanner->start );
@@ -102,143 +513,141 @@ static bool add_token(
   // fill token
   token->type = type;
   token->line = scanner->line;
-  // try to push back
-  if ( !list_push_back_data( scanner->token, token ) ) {
-    if ( message ) {
-      free( ( void* )token->start );
-    }
-    free( token );
-    return false;
-  }
   // return built token
-  return true;
+  return token;
 }
 
 /**
  * @brief Scan string
  *
- * @return
+ * @return added token
  */
-static bool scan_string( void ) {
-  // handle not initialized
-  if ( !scanner->token ) {
-    return false;
-  }
-  // loop until second double quotes
-  while ( *scanner->current && '"' != *scanner->current ) {
-    // handle line break
-    if ( '\n' == *scanner->current ) {
-      scanner->line++;
-    }
-    advance();
-  }
+static bosl_token_t* scan_string( void ) {
+  // skip string body until second double quotes
+  scanner->current = skip_until( scanner->current, '"', &scanner->line );
   // handle end reached
-  if ( '\0' == scanner->current[ 0 ] ) {
+  if ( scanner->current == scanner->end ) {
     return add_token( TOKEN_ERROR, "Unterminated string found" );
   }
   // get beyond closing double quotes
   advance();
-  // return string token
-  if ( !add_token( TOKEN_STRING, NULL ) ) {
-    return false;
-  }
-  // get last added and get rid of beginning and ending quotes
-  bosl_token_t* token = scanner->token->last->data;
+  // add string token and get rid of beginning and ending quotes
+  bosl_token_t* token = add_token( TOKEN_STRING, NULL );
   token->length -= 2;
   token->start++;
-  // return success
-  return true;
+  // return added token
+  return token;
 }
 
 /**
  * @brief Scan identifier
  *
- * @return
+ * @return added token
+ *
+ * @note identifier has been consumed already by the automaton
  */
-static bool scan_identifier( void ) {
-  // handle not initialized
-  if ( !scanner->token ) {
-    return false;
+static bosl_token_t* scan_identifier( void ) {
+  // try to get type
+  bosl_token_type_t type = keyword_type(
+    scanner->start,
+    ( size_t )( scanner->current - scanner->start )
+  );
+  // keywords are returned directly
+  if ( TOKEN_IDENTIFIER != type ) {
+    return add_token( type, NULL );
   }
-  // get beyond alpha numeric
-  while (
-    *scanner->current
-    && (
-      isalnum( ( int )*scanner->current )
-      || '_' == *scanner->current
-    ) ) {
-    advance();
+  // atom table isn't thread safe, so chunk workers leave interning to caller
+  if ( scanner->defer_atom ) {
+    return add_token( TOKEN_IDENTIFIER, NULL );
   }
-  // try to get type
-  void* raw_type = hashmap_value_get_n(
-    scanner->keyword,
+  // intern identifier
+  bosl_atom_t atom = bosl_atom_intern(
     scanner->start,
     ( size_t )( scanner->current - scanner->start )
   );
-  // transform to token type
-  bosl_token_type_t type = TOKEN_IDENTIFIER;
-  if ( raw_type ) {
-    type = ( bosl_token_type_t )raw_type;
+  if ( BOSL_ATOM_NONE == atom ) {
+    return add_token( TOKEN_ERROR, "Not enough memory for identifier" );
   }
-  // return created type
-  return add_token( type, NULL );
+  // set atom of added token
+  bosl_token_t* token = add_token( TOKEN_IDENTIFIER, NULL );
+  token->atom = atom;
+  // return added token
+  return token;
 }
 
 /**
- * @brief Scan number
+ * @brief Scan number and decode its value
  *
- * @return
+ * @param is_float
+ * @return added token
+ *
+ * @note number has been consumed already by the automaton
  */
-static bool scan_number( void ) {
-  // handle not initialized
-  if ( !scanner->token ) {
-    return false;
+static bosl_token_t* scan_number( bool is_float ) {
+  bosl_token_t* token = add_token( TOKEN_NUMBER, NULL );
+  char* end;
+  // decode value once, so that parser doesn't have to
+  if ( is_float ) {
+    token->float_number = strtold( token->start, &end );
+    token->number_type = TOKEN_NUMBER_TYPE_FLOAT;
+  } else {
+    token->unsigned_number = strtoull( token->start, &end, 0 );
+    token->number_type = TOKEN_NUMBER_TYPE_INT;
   }
-  // loop until non digit
-  while ( isdigit( ( int )*scanner->current ) ) {
-    advance();
-  }
-  bool is_hex = 'x' == *scanner->current || 'X' == *scanner->current;
-  bool is_float = '.' == *scanner->current;
-  // continue loop if hex or float
-  if (
-    ( is_float && isdigit( ( int )next() ) )
-    || ( is_hex && isalnum( ( int )next() ) ) ) {
-    // skip xX.
-    advance();
-    // loop until non digit
-    while (
-      ( is_float && isdigit( ( int )*scanner->current ) )
-      || ( is_hex && isalnum( ( int )*scanner->current ) ) ) {
-      advance();
-    }
+  // mark as invalid if not decoded completely
+  if ( end != token->start + token->length ) {
+    token->number_type = TOKEN_NUMBER_TYPE_INVALID;
   }
-  // add token
-  return add_token( TOKEN_NUMBER, NULL );
+  // return added token
+  return token;
 }
 
 /**
  * @brief Helper to scan a token
  *
- * @return
+ * @return added token or NULL if only whitespace or a comment was skipped
  */
-static bool scan_token( void ) {
+static bosl_token_t* scan_token( void ) {
+  const unsigned char* current = ( const unsigned char* )scanner->current;
+  uint8_t character_class = char_class[ *current ];
+  uint8_t state = STATE_START;
+  uint8_t next;
+  // whitespace and line breaks are skipped blockwise
+  if ( CLASS_SPACE == character_class || CLASS_NEWLINE == character_class ) {
+    scanner->current = skip_space( scanner->current, &scanner->line );
+    return NULL;
+  }
+  // run automaton over identifier and number characters
+  while ( STATE_STOP != ( next = transition[ state ][ char_class[ *current ] ] ) ) {
+    state = next;
+    current++;
+  }
+  // step back from incomplete float or hex prefix like "1." or "1x"
+  if ( STATE_NUMBER_DOT == state || STATE_NUMBER_HEX_PREFIX == state ) {
+    state = STATE_NUMBER;
+    current--;
+  }
+  // apply consumed characters
+  scanner->current = ( const char* )current;
+  switch ( state ) {
+    case STATE_IDENTIFIER:
+      return scan_identifier();
+    case STATE_NUMBER:
+    case STATE_HEX:
+      return scan_number( false );
+    case STATE_FLOAT:
+      return scan_number( true );
+  }
+
   // get character and increase current to next one
-  char current = advance();
-
-  if ( isdigit( current ) ) {
-    // handle start of number
-    return scan_number();
-  } else if ( isalpha( current ) ) {
-    // handle start of identifier
-    return scan_identifier();
-  } else if ( '"' == current ) {
-    // handle start of string
+  char character = advance();
+  // handle start of string
+  if ( '"' == character ) {
     return scan_string();
   }
 
   // handle possible
-  switch ( current ) {
+  switch ( character ) {
     // single character tokens
     case '(':
       return add_token( TOKEN_LEFT_PARENTHESIS, NULL );
@@ -269,9 +678,7 @@ static bool scan_token( void ) {
     case '/': {
       // handle comment ( skip )
       if ( match( '/' ) ) {
-        while ( *scanner->current && '\n' != *scanner->current ) {
-          advance();
-        }
+        scanner->current = skip_until( scanner->current, '\n', &scanner->line );
       } else {
         // normal slash token
         return add_token( TOKEN_SLASH, NULL );
@@ -298,37 +705,242 @@ static bool scan_token( void ) {
       return add_token( match( '&' ) ? TOKEN_AND_AND : TOKEN_AND, NULL );
     case '|':
       return add_token( match( '|' ) ? TOKEN_OR_OR : TOKEN_OR, NULL );
-    case ' ':
-    case '\r':
-    case '\t':
-      // whitespace / newlines are ignore
-      break;
-    case '\n':
-      scanner->line++;
-      break;
     default:
       // unknown token
       return add_token( TOKEN_ERROR, "Unknown token" );
   }
-  // return success
+  // comment skipped
+  return NULL;
+}
+
+#if defined( SCANNER_PARALLEL )
+VECTOR_DEFINE( scanner_chunk_token, bosl_token_t )
+
+/**
+ * @brief Chunk of source scanned by a worker
+ */
+typedef struct {
+  // source and range of chunk
+  const char* source;
+  const char* begin;
+  const char* end;
+  const char* source_end;
+  // position and line where scanning stopped
+  const char* stop;
+  uint32_t line;
+  // lines to add to token lines
+  uint32_t line_offset;
+  // line breaks within range of chunk
+  uint32_t newline;
+  bool failed;
+  scanner_chunk_token_t token;
+} scanner_chunk_t;
+
+/**
+ * @brief Scan chunk starting at given position
+ *
+ * @param chunk
+ * @param from
+ * @param line
+ *
+ * @note last token may reach beyond end of chunk
+ */
+static void scan_chunk( scanner_chunk_t* chunk, const char* from, uint32_t line ) {
+  bosl_scanner_t* previous = scanner;
+  bosl_scanner_t local;
+  // setup own scanner instance
+  memset( &local, 0, sizeof( local ) );
+  local.source = chunk->source;
+  local.current = from;
+  local.end = chunk->source_end;
+  local.line = line;
+  local.defer_atom = true;
+  scanner = &local;
+  // scan until end of chunk is reached
+  while ( local.current < chunk->end ) {
+    local.start = local.current;
+    scan_token();
+    // move token out of lookahead buffer
+    while ( local.lookahead_count ) {
+      scanner_chunk_token_t* token = &chunk->token;
+      if (
+        token->size < token->capacity
+        || scanner_chunk_token_reserve(
+          token, VECTOR_ENLARGE_CAPACITY( token->capacity ) )
+      ) {
+        token->data[ token->size++ ] = local.lookahead[ local.lookahead_head ];
+      } else {
+        chunk->failed = true;
+      }
+      local.lookahead_head = ( local.lookahead_head + 1 )
+        % BOSL_SCANNER_LOOKAHEAD;
+      local.lookahead_count--;
+    }
+  }
+  // save stop position and restore scanner
+  chunk->stop = local.current;
+  chunk->line = local.line;
+  scanner = previous;
+}
+
+/**
+ * @brief Chunk worker
+ *
+ * @param data
+ * @return
+ */
+static void* scan_chunk_worker( void* data ) {
+  scanner_chunk_t* chunk = data;
+  // count line breaks of chunk to get line offset of following ones
+  for ( const char* c = chunk->begin; c < chunk->end; c++ ) {
+    chunk->newline += '\n' == *c;
+  }
+  // scan chunk
+  scan_chunk( chunk, chunk->begin, 1 );
+  return NULL;
+}
+
+/**
+ * @brief Check whether previous chunk stopped at a token boundary of chunk
+ *
+ * @param stop
+ * @param begin
+ * @return
+ *
+ * @note previous chunk may have skipped whitespace beyond the begin, if
+ * anything else was consumed the split landed within a string
+ */
+static bool scan_chunk_aligned( const char* stop, const char* begin ) {
+  for ( ; begin < stop; begin++ ) {
+    uint8_t character_class = char_class[ ( unsigned char )*begin ];
+    if ( CLASS_SPACE != character_class && CLASS_NEWLINE != character_class ) {
+      return false;
+    }
+  }
   return true;
 }
 
 /**
- * @brief Token list cleanup helper
+ * @brief Scan source in parallel chunks split at line breaks
  *
- * @param a
+ * @return
  */
-static void token_list_cleanup( list_item_t* a ) {
-  bosl_token_t* token = a->data;
-  if ( TOKEN_ERROR == token->type ) {
-    free( ( void* )token->start );
+static bool scan_parallel( void ) {
+  size_t length = ( size_t )( scanner->end - scanner->source );
+  long online = sysconf( _SC_NPROCESSORS_ONLN );
+  size_t count = length / SCANNER_PARALLEL_CHUNK_MIN;
+  // limit chunks by available processors
+  if ( 0 < online && ( size_t )online < count ) {
+    count = ( size_t )online;
+  }
+  if ( SCANNER_PARALLEL_CHUNK_MAX < count ) {
+    count = SCANNER_PARALLEL_CHUNK_MAX;
+  }
+  if ( 2 > count ) {
+    return false;
+  }
+  scanner_chunk_t chunk[ SCANNER_PARALLEL_CHUNK_MAX ];
+  pthread_t thread[ SCANNER_PARALLEL_CHUNK_MAX ];
+  bool started[ SCANNER_PARALLEL_CHUNK_MAX ];
+  // split source after line breaks
+  const char* begin = scanner->source;
+  size_t used = 0;
+  for ( size_t index = 0; index < count && begin < scanner->end; index++ ) {
+    const char* end = scanner->end;
+    if ( index + 1 < count ) {
+      const char* split = scanner->source + length / count * ( index + 1 );
+      if ( split < begin ) {
+        split = begin;
+      }
+      const char* newline = memchr(
+        split, '\n', ( size_t )( scanner->end - split ) );
+      end = newline ? newline + 1 : scanner->end;
+    }
+    memset( &chunk[ used ], 0, sizeof( chunk[ used ] ) );
+    chunk[ used ].source = scanner->source;
+    chunk[ used ].begin = begin;
+    chunk[ used ].end = end;
+    chunk[ used ].source_end = scanner->end;
+    scanner_chunk_token_init( &chunk[ used ].token );
+    begin = end;
+    used++;
   }
-  // free inner data structure
-  free( token );
-  // default cleanup
-  list_default_cleanup( a );
+  // start workers, scan directly if no thread could be created
+  for ( size_t index = 0; index < used; index++ ) {
+    started[ index ] = !pthread_create(
+      &thread[ index ], NULL, scan_chunk_worker, &chunk[ index ] );
+    if ( !started[ index ] ) {
+      scan_chunk_worker( &chunk[ index ] );
+    }
+  }
+  for ( size_t index = 0; index < used; index++ ) {
+    if ( started[ index ] ) {
+      pthread_join( thread[ index ], NULL );
+    }
+  }
+  // stitch chunks, rescan those where a string was split
+  bool failed = false;
+  size_t total = 1;
+  uint32_t line_offset = 0;
+  for ( size_t index = 0; index < used; index++ ) {
+    chunk[ index ].line_offset = line_offset;
+    line_offset += chunk[ index ].newline;
+    if (
+      index
+      && !scan_chunk_aligned( chunk[ index - 1 ].stop, chunk[ index ].begin )
+    ) {
+      scanner_chunk_t* previous = &chunk[ index - 1 ];
+      // rescan from stop of previous one with absolute line numbers
+      scanner_chunk_token_free( &chunk[ index ].token );
+      chunk[ index ].line_offset = 0;
+      if ( previous->stop < chunk[ index ].end ) {
+        scan_chunk(
+          &chunk[ index ], previous->stop, previous->line_offset + previous->line );
+      } else {
+        // previous one covered this chunk completely
+        chunk[ index ].stop = previous->stop;
+        chunk[ index ].line = previous->line_offset + previous->line;
+      }
+    }
+    failed |= chunk[ index ].failed;
+    total += scanner_chunk_token_size( &chunk[ index ].token );
+  }
+  // merge token into one array, with eof at the end
+  bosl_token_t* token = failed ? NULL : malloc( sizeof( *token ) * total );
+  size_t position = 0;
+  for ( size_t index = 0; index < used; index++ ) {
+    size_t size = scanner_chunk_token_size( &chunk[ index ].token );
+    for ( size_t current = 0; token && current < size; current++ ) {
+      bosl_token_t* t = &token[ position++ ];
+      *t = *scanner_chunk_token_at( &chunk[ index ].token, current );
+      t->line += chunk[ index ].line_offset;
+      // intern identifier which was deferred by worker
+      if ( TOKEN_IDENTIFIER == t->type ) {
+        t->atom = bosl_atom_intern( t->start, t->length );
+        if ( BOSL_ATOM_NONE == t->atom ) {
+          free( token );
+          token = NULL;
+        }
+      }
+    }
+    scanner_chunk_token_free( &chunk[ index ].token );
+  }
+  if ( !token ) {
+    return false;
+  }
+  // add eof token
+  memset( &token[ position ], 0, sizeof( *token ) );
+  token[ position ].type = TOKEN_EOF;
+  token[ position ].start = scanner->end;
+  token[ position ].line = chunk[ used - 1 ].line_offset
+    + chunk[ used - 1 ].line;
+  // take over token
+  scanner->prescanned = token;
+  scanner->prescanned_size = total;
+  scanner->prescanned_index = 0;
+  return true;
 }
+#endif
 
 /**
  * @brief Prepare and setup scanner
@@ -352,54 +964,27 @@ bool bosl_scanner_init( const char* source ) {
   scanner->source = source;
   scanner->start = source;
   scanner->current = source;
+  scanner->end = source + strlen( source );
   scanner->line = 1;
-  // generate token list
-  scanner->token = list_construct( NULL, token_list_cleanup, NULL );
-  if ( !scanner->token ) {
+  // generate arena for retained token
+  scanner->arena = arena_construct();
+  if ( !scanner->arena ) {
     free( scanner );
     return false;
   }
-  // create and fill hash map
-  scanner->keyword = hashmap_construct( NULL );
-  if ( !scanner->keyword ) {
-    list_destruct( scanner->token );
+  // generate token list
+  scanner->token = vector_construct( NULL );
+  if ( !scanner->token ) {
+    arena_destruct( scanner->arena );
     free( scanner );
     return false;
   }
-  // populate hashmap with keywords
-  if (
-    !hashmap_value_set( scanner->keyword, "let", ( void* )TOKEN_LET )
-    || !hashmap_value_set( scanner->keyword, "const", ( void* )TOKEN_CONST )
-    || !hashmap_value_set( scanner->keyword, "pointer", ( void* )TOKEN_POINTER )
-    || !hashmap_value_set( scanner->keyword, "true", ( void* )TOKEN_TRUE )
-    || !hashmap_value_set( scanner->keyword, "false", ( void* )TOKEN_FALSE )
-    || !hashmap_value_set( scanner->keyword, "null", ( void* )TOKEN_NULL )
-    || !hashmap_value_set( scanner->keyword, "if", ( void* )TOKEN_IF )
-    || !hashmap_value_set( scanner->keyword, "else", ( void* )TOKEN_ELSE )
-    || !hashmap_value_set( scanner->keyword, "while", ( void* )TOKEN_WHILE )
-    || !hashmap_value_set( scanner->keyword, "break", ( void* )TOKEN_BREAK )
-    || !hashmap_value_set( scanner->keyword, "continue", ( void* )TOKEN_CONTINUE )
-    || !hashmap_value_set( scanner->keyword, "fn", ( void* )TOKEN_FUNCTION )
-    || !hashmap_value_set( scanner->keyword, "return", ( void* )TOKEN_RETURN )
-    || !hashmap_value_set( scanner->keyword, "load", ( void* )TOKEN_LOAD )
-    || !hashmap_value_set( scanner->keyword, "int8", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "int16", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "int32", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "int64", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "uint8", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "uint16", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "uint32", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "uint64", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "float", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "string", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "void", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "bool", ( void* )TOKEN_TYPE_IDENTIFIER )
-    || !hashmap_value_set( scanner->keyword, "print", ( void* )TOKEN_PRINT ) ) {
-    hashmap_destruct( scanner->keyword );
-    list_destruct( scanner->token );
-    free( scanner );
-    return false;
+#if defined( SCANNER_PARALLEL )
+  // scan large sources in parallel, on failure token are scanned on demand
+  if ( BOSL_SCANNER_PARALLEL_THRESHOLD <= scanner->end - scanner->source ) {
+    scan_parallel();
   }
+#endif
   // return success
   return true;
 }
@@ -412,38 +997,118 @@ void bosl_scanner_free( void ) {
   if ( !scanner ) {
     return;
   }
-  // destroy list and hash map
-  list_destruct( scanner->token );
-  hashmap_destruct( scanner->keyword );
+  // destroy token list and retained token
+  vector_destruct( scanner->token );
+  arena_destruct( scanner->arena );
+  free( scanner->prescanned );
   // finally free instance
   free( scanner );
 }
 
 /**
- * @brief Scan and return list of tokens
+ * @brief Peek at upcoming token without consuming it
  *
- * @return
+ * @param offset
+ * @return token or NULL if offset exceeds lookahead
+ *
+ * @note returned token is valid until the lookahead buffer wraps around
  */
-list_manager_t* bosl_scanner_scan( void ) {
-  // handle call without init
-  if ( !scanner ) {
+bosl_token_t* bosl_scanner_peek_token( size_t offset ) {
+  // handle call without init or offset out of lookahead range
+  if ( !scanner || BOSL_SCANNER_LOOKAHEAD - 1 <= offset ) {
     return NULL;
   }
-  // loop until end
-  while ( *scanner->current ) {
+  // scan until enough token are buffered
+  while ( scanner->lookahead_count <= offset ) {
+#if defined( SCANNER_PARALLEL )
+    // take over token scanned in parallel, last one is eof
+    if ( scanner->prescanned ) {
+      *add_token( TOKEN_EOF, NULL ) = scanner->prescanned[
+        scanner->prescanned_index ];
+      if ( scanner->prescanned_index + 1 < scanner->prescanned_size ) {
+        scanner->prescanned_index++;
+      }
+      continue;
+    }
+#endif
     // set start to current
     scanner->start = scanner->current;
-    // scan token
-    if ( !scan_token() ) {
-      return NULL;
+    // add eof token at the end, else scan next one
+    if ( scanner->current == scanner->end ) {
+      add_token( TOKEN_EOF, NULL );
+    } else {
+      scan_token();
     }
   }
-  // push scanner start one more time
-  scanner->start = scanner->current;
-  // add eof token
-  if ( !add_token( TOKEN_EOF, NULL ) ) {
+  // return buffered token
+  return &scanner->lookahead[
+    ( scanner->lookahead_head + offset ) % BOSL_SCANNER_LOOKAHEAD
+  ];
+}
+
+/**
+ * @brief Consume next token
+ *
+ * @return token or NULL on error
+ *
+ * @note returned token stays valid while further token within lookahead are
+ * peeked, use bosl_scanner_retain_token to keep it longer
+ */
+bosl_token_t* bosl_scanner_next_token( void ) {
+  // get next token
+  bosl_token_t* token = bosl_scanner_peek_token( 0 );
+  if ( !token ) {
+    return NULL;
+  }
+  // remove it from buffered ones
+  scanner->lookahead_head = ( scanner->lookahead_head + 1 )
+    % BOSL_SCANNER_LOOKAHEAD;
+  scanner->lookahead_count--;
+  // return token
+  return token;
+}
+
+/**
+ * @brief Retain a token until scanner is freed
+ *
+ * @param token
+ * @return retained copy or NULL on error
+ *
+ * @note copies are placed next to each other within the scanner arena
+ */
+bosl_token_t* bosl_scanner_retain_token( const bosl_token_t* token ) {
+  // handle call without init or invalid token
+  if ( !scanner || !token ) {
     return NULL;
   }
+  // allocate copy
+  bosl_token_t* copy = arena_allocate( scanner->arena, sizeof( *copy ) );
+  if ( !copy ) {
+    return NULL;
+  }
+  memcpy( copy, token, sizeof( *copy ) );
+  // return copy
+  return copy;
+}
+
+/**
+ * @brief Scan and return list of tokens
+ *
+ * @return
+ */
+vector_t* bosl_scanner_scan( void ) {
+  // handle call without init
+  if ( !scanner ) {
+    return NULL;
+  }
+  // retain token until end
+  bosl_token_t* token;
+  do {
+    token = bosl_scanner_retain_token( bosl_scanner_next_token() );
+    if ( !token || !vector_push_back( scanner->token, token ) ) {
+      return NULL;
+    }
+  } while ( TOKEN_EOF != token->type );
   // return list of tokens
   return scanner->token;
 }
@@ -21,11 +21,13 @@
 #include <stdbool.h>
 
 #if defined( _COMPILING_BOSL )
-  #include "collection/list.h"
-  #include "collection/hashmap.h"
+  #include "collection/vector.h"
+  #include "collection/arena.h"
+  #include "atom.h"
 #else
-  #include <bosl/collection/list.h>
-  #include <bosl/collection/hashmap.h>
+  #include <bosl/collection/vector.h>
+  #include <bosl/collection/arena.h>
+  #include <bosl/atom.h>
 #endif
 
 #if !defined( BOSL_SCANNER_H )
@@ -35,6 +37,11 @@
 extern "C" {
 #endif
 
+// amount of buffered token including the last consumed one
+#define BOSL_SCANNER_LOOKAHEAD 4
+// source size from which on token are scanned in parallel if enabled
+#define BOSL_SCANNER_PARALLEL_THRESHOLD ( 1024 * 1024 )
+
 typedef enum {
   // single character tokens
   TOKEN_LEFT_PARENTHESIS,
@@ -101,25 +108,49 @@ typedef enum {
   TOKEN_EOF,
 } bosl_token_type_t;
 
+typedef enum {
+  TOKEN_NUMBER_TYPE_INVALID = 0,
+  TOKEN_NUMBER_TYPE_INT,
+  TOKEN_NUMBER_TYPE_FLOAT,
+} bosl_token_number_type_t;
+
 typedef struct bosl_token {
   bosl_token_type_t type;
   const char* start;
   uint32_t line;
+  bosl_atom_t atom;
   size_t length;
+  // value of number token decoded while scanning
+  bosl_token_number_type_t number_type;
+  union {
+    uint64_t unsigned_number;
+    long double float_number;
+  };
 } bosl_token_t;
 
 typedef struct bosl_scanner {
   const char* source;
   const char* start;
   const char* current;
+  const char* end;
   uint32_t line;
-  list_manager_t* token;
-  hashmap_table_t* keyword;
+  bosl_token_t lookahead[ BOSL_SCANNER_LOOKAHEAD ];
+  size_t lookahead_head;
+  size_t lookahead_count;
+  bosl_token_t* prescanned;
+  size_t prescanned_size;
+  size_t prescanned_index;
+  bool defer_atom;
+  arena_t* arena;
+  vector_t* token;
 } bosl_scanner_t;
 
 bool bosl_scanner_init( const char* );
 void bosl_scanner_free( void );
-list_manager_t* bosl_scanner_scan( void );
+bosl_token_t* bosl_scanner_peek_token( size_t );
+bosl_token_t* bosl_scanner_next_token( void );
+bosl_token_t* bosl_scanner_retain_token( const bosl_token_t* );
+vector_t* bosl_scanner_scan( void );
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,1274 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include "value.h"
+#include "object.h"
+#include "error.h"
+#include "interpreter.h"
+
+// numbers extracted from a value
+typedef struct {
+  uint64_t unsigned_number;
+  int64_t signed_number;
+  long double float_number;
+} value_number_t;
+
+/**
+ * @brief Helper to check whether value refers to a heap object
+ *
+ * @param value
+ * @return
+ */
+static bool is_heap( bosl_value_t* value ) {
+  return BOSL_OBJECT_VALUE_STRING == value->value_type
+    || BOSL_OBJECT_VALUE_CALLABLE == value->value_type;
+}
+
+/**
+ * @brief Build value from literal
+ *
+ * @param literal
+ * @param value
+ * @return
+ */
+bool bosl_value_from_literal(
+  bosl_ast_expression_literal_t* literal,
+  bosl_value_t* value
+) {
+  // literals are never part of an environment
+  value->environment = false;
+  // determine type and copy payload
+  switch ( literal->type ) {
+    case EXPRESSION_LITERAL_TYPE_BOOL:
+      value->value_type = BOSL_OBJECT_VALUE_BOOL;
+      value->type = BOSL_OBJECT_TYPE_BOOL;
+      value->boolean = *( ( bool* )literal->value );
+      return true;
+    case EXPRESSION_LITERAL_TYPE_NULL:
+      value->value_type = BOSL_OBJECT_VALUE_NULL;
+      value->type = BOSL_OBJECT_TYPE_UNDEFINED;
+      value->unsigned_number = 0;
+      return true;
+    case EXPRESSION_LITERAL_TYPE_NUMBER_FLOAT:
+      value->value_type = BOSL_OBJECT_VALUE_FLOAT;
+      value->type = BOSL_OBJECT_TYPE_FLOAT;
+      memcpy( &value->float_number, literal->value, sizeof( long double ) );
+      return true;
+    case EXPRESSION_LITERAL_TYPE_NUMBER_INT:
+      value->value_type = BOSL_OBJECT_VALUE_INT_UNSIGNED;
+      value->type = BOSL_OBJECT_TYPE_UINT_64;
+      memcpy( &value->unsigned_number, literal->value, sizeof( uint64_t ) );
+      return true;
+    case EXPRESSION_LITERAL_TYPE_STRING:
+      value->value_type = BOSL_OBJECT_VALUE_STRING;
+      value->type = BOSL_OBJECT_TYPE_STRING;
+      // strings are the only literals which need a heap object
+      value->object = bosl_object_allocate(
+        BOSL_OBJECT_VALUE_STRING,
+        BOSL_OBJECT_TYPE_STRING,
+        literal->value,
+        literal->size
+      );
+      return value->object;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Build value from object without taking over ownership
+ *
+ * @param object
+ * @param value
+ */
+void bosl_value_from_object( bosl_object_t* object, bosl_value_t* value ) {
+  // copy type information
+  value->value_type = object->value_type;
+  value->type = object->type;
+  value->environment = object->environment;
+  // copy payload
+  switch ( object->value_type ) {
+    case BOSL_OBJECT_VALUE_FLOAT:
+      memcpy( &value->float_number, object->data, sizeof( long double ) );
+      break;
+    case BOSL_OBJECT_VALUE_INT_SIGNED:
+    case BOSL_OBJECT_VALUE_INT_UNSIGNED:
+      memcpy( &value->unsigned_number, object->data, sizeof( uint64_t ) );
+      break;
+    case BOSL_OBJECT_VALUE_BOOL:
+      value->boolean = *( ( bool* )object->data );
+      break;
+    case BOSL_OBJECT_VALUE_STRING:
+    case BOSL_OBJECT_VALUE_CALLABLE:
+      value->object = object;
+      break;
+    default:
+      value->unsigned_number = 0;
+      break;
+  }
+}
+
+/**
+ * @brief Build value from object and take over ownership
+ *
+ * @param object
+ * @param value
+ *
+ * @note object mustn't be used afterwards
+ */
+void bosl_value_unbox( bosl_object_t* object, bosl_value_t* value ) {
+  // build value
+  bosl_value_from_object( object, value );
+  // heap payload is taken over by the value
+  if ( is_heap( value ) ) {
+    return;
+  }
+  // release object as payload has been copied
+  bosl_object_release( object );
+}
+
+/**
+ * @brief Build object from value
+ *
+ * @param value
+ * @return
+ *
+ * @note value mustn't be used afterwards in case of success
+ */
+bosl_object_t* bosl_value_box( bosl_value_t* value ) {
+  switch ( value->value_type ) {
+    case BOSL_OBJECT_VALUE_STRING:
+    case BOSL_OBJECT_VALUE_CALLABLE: {
+      // take heap object or duplicate it if part of environment
+      bosl_object_t* object = bosl_object_duplicate_environment( value->object );
+      if ( object ) {
+        object->type = value->type;
+      }
+      return object;
+    }
+    case BOSL_OBJECT_VALUE_FLOAT:
+      return bosl_object_allocate( value->value_type, value->type,
+        &value->float_number, sizeof( value->float_number ) );
+    case BOSL_OBJECT_VALUE_INT_SIGNED:
+    case BOSL_OBJECT_VALUE_INT_UNSIGNED:
+      return bosl_object_allocate( value->value_type, value->type,
+        &value->unsigned_number, sizeof( value->unsigned_number ) );
+    case BOSL_OBJECT_VALUE_BOOL:
+      return bosl_object_allocate( value->value_type, value->type,
+        &value->boolean, sizeof( value->boolean ) );
+    case BOSL_OBJECT_VALUE_NULL:
+      return bosl_object_allocate( value->value_type, value->type, NULL, 0 );
+    default:
+      return NULL;
+  }
+}
+
+/**
+ * @brief Ensure that value owns its heap object
+ *
+ * @param value
+ * @return
+ */
+bool bosl_value_own( bosl_value_t* value ) {
+  // nothing to do for inline values or owned objects
+  if ( !is_heap( value ) || !value->object->environment ) {
+    return true;
+  }
+  // duplicate environment object
+  bosl_object_t* duplicate = bosl_object_duplicate_environment( value->object );
+  if ( !duplicate ) {
+    return false;
+  }
+  // replace object
+  value->object = duplicate;
+  value->environment = false;
+  return true;
+}
+
+/**
+ * @brief Release heap object of a value if owned
+ *
+ * @param value
+ */
+void bosl_value_release( bosl_value_t* value ) {
+  if ( is_heap( value ) ) {
+    bosl_object_release( value->object );
+  }
+}
+
+/**
+ * @brief Helper to extract number from value
+ *
+ * @param value
+ * @param unsigned_number
+ * @param signed_number
+ * @param float_number
+ * @return
+ */
+bool bosl_value_extract_number(
+  bosl_value_t* value,
+  uint64_t* unsigned_number,
+  int64_t* signed_number,
+  long double* float_number
+) {
+  // extract numbers
+  switch ( value->value_type ) {
+    case BOSL_OBJECT_VALUE_FLOAT:
+      *float_number = value->float_number;
+      return true;
+    case BOSL_OBJECT_VALUE_INT_UNSIGNED:
+      *unsigned_number = value->unsigned_number;
+      return true;
+    case BOSL_OBJECT_VALUE_INT_SIGNED:
+      *signed_number = value->signed_number;
+      return true;
+    default:
+      // only numbers are handled here
+      bosl_error_raise( NULL, "Invalid object passed to extract_number." );
+      return false;
+  }
+}
+
+/**
+ * @brief Helper to convert value to string
+ *
+ * @param value
+ * @param arena
+ * @return
+ *
+ * @note buffer is taken from arena if set, otherwise allocated via malloc
+ */
+static char* value_stringify( bosl_value_t* value, arena_t* arena ) {
+  char* buffer;
+  // determine buffer size
+  size_t buffer_size = sizeof( char );
+  char count_buffer[8];
+  int digits = 0;
+  bosl_token_t* token = NULL;
+  // count by utilizing snprintf
+  switch ( value->type ) {
+    case BOSL_OBJECT_TYPE_BOOL:
+      digits = ( int )( value->boolean ? strlen( "true" ) : strlen( "false" ) );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_8:
+      digits = snprintf( count_buffer, 7, "%"PRIu8, ( uint8_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_16:
+      digits = snprintf( count_buffer, 7, "%"PRIu16, ( uint16_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_32:
+      digits = snprintf( count_buffer, 7, "%"PRIu32, ( uint32_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_64:
+      digits = snprintf( count_buffer, 7, "%"PRIu64, value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_8:
+      digits = snprintf( count_buffer, 7, "%"PRId8, ( int8_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_16:
+      digits = snprintf( count_buffer, 7, "%"PRId16, ( int16_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_32:
+      digits = snprintf( count_buffer, 7, "%"PRId32, ( int32_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_64:
+      digits = snprintf( count_buffer, 7, "%"PRId64, value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_STRING:
+      digits = ( int )value->object->size;
+      break;
+    case BOSL_OBJECT_TYPE_FLOAT:
+      digits = snprintf( count_buffer, 7, "%Lf", value->float_number );
+      break;
+    case BOSL_OBJECT_TYPE_UNDEFINED:
+      if ( BOSL_OBJECT_VALUE_NULL == value->value_type ) {
+        digits = ( int )strlen( "null" );
+      } else if ( BOSL_OBJECT_VALUE_CALLABLE == value->value_type ) {
+        token = ( ( bosl_object_callable_t* )value->object->data )->statement->token;
+        int length = ( int )token->length;
+        digits = snprintf( count_buffer, 7, "<fn %*.*s>", length, length, token->start );
+      }
+      break;
+    default:
+      return NULL;
+  }
+  // handle error
+  if ( 0 >= digits ) {
+    return NULL;
+  }
+  // multiply buffer size with digit amount
+  buffer_size *= ( size_t )( digits + 1 );
+  // allocate buffer
+  buffer = arena
+    ? arena_allocate( arena, buffer_size )
+    : malloc( buffer_size );
+  if ( !buffer ) {
+    return NULL;
+  }
+  // clear out
+  memset( buffer, 0, buffer_size );
+  // print to allocated buffer
+  switch ( value->type ) {
+    case BOSL_OBJECT_TYPE_BOOL:
+      sprintf( buffer, "%s", value->boolean ? "true" : "false" );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_8:
+      sprintf( buffer, "%"PRIu8, ( uint8_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_16:
+      sprintf( buffer, "%"PRIu16, ( uint16_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_32:
+      sprintf( buffer, "%"PRIu32, ( uint32_t )value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_UINT_64:
+      sprintf( buffer, "%"PRIu64, value->unsigned_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_8:
+      sprintf( buffer, "%"PRId8, ( int8_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_16:
+      sprintf( buffer, "%"PRId16, ( int16_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_32:
+      sprintf( buffer, "%"PRId32, ( int32_t )value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_INT_64:
+      sprintf( buffer, "%"PRId64, value->signed_number );
+      break;
+    case BOSL_OBJECT_TYPE_STRING:
+      strncpy( buffer, value->object->data, value->object->size );
+      break;
+    case BOSL_OBJECT_TYPE_FLOAT:
+      sprintf( buffer, "%Lf", value->float_number );
+      break;
+    case BOSL_OBJECT_TYPE_UNDEFINED:
+      if ( BOSL_OBJECT_VALUE_NULL == value->value_type ) {
+        sprintf( buffer, "null" );
+      } else if ( BOSL_OBJECT_VALUE_CALLABLE == value->value_type && token ) {
+        sprintf(
+          buffer, "<fn %*.*s>", ( int )token->length,
+          ( int )token->length, token->start
+        );
+      } else {
+        if ( !arena ) {
+          free( buffer );
+        }
+        return NULL;
+      }
+      break;
+    default:
+      if ( !arena ) {
+        free( buffer );
+      }
+      return NULL;
+  }
+  // return buffer
+  return buffer;
+}
+
+/**
+ * @brief Convert value to string
+ *
+ * @param value
+ * @return
+ */
+char* bosl_value_stringify( bosl_value_t* value ) {
+  return value_stringify( value, NULL );
+}
+
+/**
+ * @brief Convert value to string with buffer taken from arena
+ *
+ * @param value
+ * @param arena
+ * @return
+ */
+char* bosl_value_stringify_arena( bosl_value_t* value, arena_t* arena ) {
+  return value_stringify( value, arena );
+}
+
+/**
+ * @brief Helper to get integer of value treated as given type
+ *
+ * @param value
+ * @param type
+ * @param negative
+ * @return magnitude of the integer
+ */
+static uint64_t integer_as(
+  bosl_value_t* value,
+  bosl_object_type_t type,
+  bool* negative
+) {
+  int64_t number;
+  // truncate to type
+  switch ( type ) {
+    case BOSL_OBJECT_TYPE_UINT_8:
+      *negative = false;
+      return ( uint8_t )value->unsigned_number;
+    case BOSL_OBJECT_TYPE_UINT_16:
+      *negative = false;
+      return ( uint16_t )value->unsigned_number;
+    case BOSL_OBJECT_TYPE_UINT_32:
+      *negative = false;
+      return ( uint32_t )value->unsigned_number;
+    case BOSL_OBJECT_TYPE_UINT_64:
+      *negative = false;
+      return value->unsigned_number;
+    case BOSL_OBJECT_TYPE_INT_8:
+      number = ( int8_t )value->signed_number;
+      break;
+    case BOSL_OBJECT_TYPE_INT_16:
+      number = ( int16_t )value->signed_number;
+      break;
+    case BOSL_OBJECT_TYPE_INT_32:
+      number = ( int32_t )value->signed_number;
+      break;
+    default:
+      number = value->signed_number;
+      break;
+  }
+  // split into sign and magnitude
+  *negative = 0 > number;
+  return *negative ? 0 - ( uint64_t )number : ( uint64_t )number;
+}
+
+/**
+ * @brief Helper to check whether integer value keeps its number in other type
+ *
+ * @param value
+ * @param from
+ * @param to
+ * @return
+ */
+static bool integer_equal(
+  bosl_value_t* value,
+  bosl_object_type_t from,
+  bosl_object_type_t to
+) {
+  bool from_negative;
+  bool to_negative;
+  // get integer as both types
+  uint64_t from_magnitude = integer_as( value, from, &from_negative );
+  uint64_t to_magnitude = integer_as( value, to, &to_negative );
+  // compare
+  return from_negative == to_negative && from_magnitude == to_magnitude;
+}
+
+/**
+ * @brief Helper to check whether value fits into float
+ *
+ * @param name
+ * @param value
+ * @return
+ */
+static bool value_fits_float( bosl_token_t* name, bosl_value_t* value ) {
+  // uint to double
+  if (
+    BOSL_OBJECT_TYPE_UINT_8 <= value->type
+    && BOSL_OBJECT_TYPE_UINT_64 >= value->type ) {
+    // test whether value can be stored safely by converting with conversion
+    // back and comparison
+    long double repr;
+    *( ( volatile long double* )&repr ) = ( long double )value->unsigned_number;
+    uint64_t round_trip_value = ( uint64_t )repr;
+    // handle no assign possible
+    if ( round_trip_value != value->unsigned_number ) {
+      bosl_error_raise(
+        name,
+        "Cannot assign value %"PRIu64" with type %s to %s "
+        "( cannot be converted safely ).", value->unsigned_number,
+        bosl_object_type_to_str( value->type ),
+        bosl_object_type_to_str( BOSL_OBJECT_TYPE_FLOAT )
+      );
+      return false;
+    }
+  } else {
+    // int to double conversion
+    // test whether value can be stored safely by converting with conversion
+    // back and comparison
+    long double repr;
+    *( ( volatile long double* )&repr ) = ( long double )value->signed_number;
+    int64_t round_trip_value = ( int64_t )repr;
+    // handle no assign possible
+    if ( round_trip_value != value->signed_number ) {
+      bosl_error_raise(
+        name,
+        "Cannot assign value %"PRId64" with type %s to %s "
+        "( cannot be converted safely ).", value->signed_number,
+        bosl_object_type_to_str( value->type ),
+        bosl_object_type_to_str( BOSL_OBJECT_TYPE_FLOAT )
+      );
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to check compatibility of value with object type
+ *
+ * @param name
+ * @param object_type
+ * @param value
+ * @param convert
+ * @return
+ */
+static bool value_check(
+  bosl_token_t* name,
+  bosl_object_type_t object_type,
+  bosl_value_t* value,
+  bool convert
+) {
+  // Check usual incompatibilities
+  if (
+    (
+      // handle string expected but no string in value
+      BOSL_OBJECT_TYPE_STRING == object_type
+      && BOSL_OBJECT_TYPE_STRING != value->type
+    ) || (
+      // handle integer expected but decimal received
+      BOSL_OBJECT_TYPE_UINT_8 <= object_type
+      && BOSL_OBJECT_TYPE_INT_64 >= object_type
+      && (
+        BOSL_OBJECT_TYPE_BOOL == value->type
+        || BOSL_OBJECT_TYPE_FLOAT == value->type
+        || BOSL_OBJECT_TYPE_STRING == value->type
+      )
+    ) ) {
+    bosl_error_raise(
+      name, "Cannot assign %s to %s.",
+      bosl_object_type_to_str( value->type ),
+      bosl_object_type_to_str( object_type )
+    );
+    return false;
+  }
+  // nothing to check if types are matching
+  if ( object_type == value->type ) {
+    return true;
+  }
+  // only numbers are convertible
+  if ( value->value_type > BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
+    bosl_error_raise( NULL, "Invalid object passed to extract_number." );
+    bosl_error_raise( name, "Unable to extract value number." );
+    return false;
+  }
+  // signed / unsigned integer to float conversion
+  if (
+    BOSL_OBJECT_TYPE_FLOAT == object_type
+    && BOSL_OBJECT_TYPE_UINT_8 <= value->type
+    && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
+    if ( !value_fits_float( name, value ) ) {
+      if ( !convert ) {
+        bosl_error_raise( name, "Value to big for type float." );
+      }
+      return false;
+    }
+    // convert to float if requested
+    if ( convert ) {
+      if (
+        BOSL_OBJECT_TYPE_UINT_8 <= value->type
+        && BOSL_OBJECT_TYPE_UINT_64 >= value->type
+      ) {
+        value->float_number = ( long double )value->unsigned_number;
+      } else {
+        value->float_number = ( long double )value->signed_number;
+      }
+      value->value_type = BOSL_OBJECT_VALUE_FLOAT;
+    }
+  } else if (
+    BOSL_OBJECT_TYPE_UINT_8 <= object_type
+    && BOSL_OBJECT_TYPE_INT_64 >= object_type
+    && BOSL_OBJECT_TYPE_UINT_8 <= value->type
+    && BOSL_OBJECT_TYPE_INT_64 >= value->type ) {
+    // treat a different number after conversion as incompatible
+    if ( !integer_equal( value, value->type, object_type ) ) {
+      // transform value to string for error message
+      char* value_str = bosl_value_stringify( value );
+      bosl_error_raise(
+        name, "Range error: %s is not in range of type %s.",
+        value_str ? value_str : "value",
+        bosl_object_type_to_str( object_type )
+      );
+      free( value_str );
+      return false;
+    }
+  }
+  // success
+  return true;
+}
+
+/**
+ * @brief Helper to validate a value
+ *
+ * @param name
+ * @param object_type
+ * @param value
+ * @return
+ */
+bool bosl_value_validate(
+  bosl_token_t* name,
+  bosl_object_type_t object_type,
+  bosl_value_t* value
+) {
+  if ( name ) {
+    object_type = bosl_object_str_to_type( name->start, name->length );
+  }
+  return value_check( name, object_type, value, false );
+}
+
+/**
+ * @brief Convert value to given object type
+ *
+ * @param name
+ * @param object_type
+ * @param value
+ * @return
+ */
+bool bosl_value_convert(
+  bosl_token_t* name,
+  bosl_object_type_t object_type,
+  bosl_value_t* value
+) {
+  // check and convert value
+  if ( !value_check( name, object_type, value, true ) ) {
+    return false;
+  }
+  // set type of value
+  value->type = object_type;
+  return true;
+}
+
+/**
+ * @brief Overwrite payload of an object in place
+ *
+ * @param object
+ * @param value
+ * @return
+ *
+ * @note only inline values with a payload of same size are stored, false is
+ * returned if a new object is necessary
+ */
+bool bosl_value_store( bosl_object_t* object, bosl_value_t* value ) {
+  void* payload;
+  size_t size;
+  // heap objects and values are not overwritten
+  if (
+    is_heap( value )
+    || BOSL_OBJECT_VALUE_STRING == object->value_type
+    || BOSL_OBJECT_VALUE_CALLABLE == object->value_type
+  ) {
+    return false;
+  }
+  // determine payload
+  switch ( value->value_type ) {
+    case BOSL_OBJECT_VALUE_FLOAT:
+      payload = &value->float_number;
+      size = sizeof( value->float_number );
+      break;
+    case BOSL_OBJECT_VALUE_INT_SIGNED:
+    case BOSL_OBJECT_VALUE_INT_UNSIGNED:
+      payload = &value->unsigned_number;
+      size = sizeof( value->unsigned_number );
+      break;
+    case BOSL_OBJECT_VALUE_BOOL:
+      payload = &value->boolean;
+      size = sizeof( value->boolean );
+      break;
+    default:
+      return false;
+  }
+  // payload has to fit exactly
+  if ( !object->data || object->size != size ) {
+    return false;
+  }
+  // overwrite payload and types
+  memcpy( object->data, payload, size );
+  object->value_type = value->value_type;
+  object->type = value->type;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to check whether value is truthy
+ *
+ * @param value
+ * @return
+ *
+ * @todo Treat values ( int, uint, float ) as true if not 0
+ */
+bool bosl_value_is_truthy( bosl_value_t* value ) {
+  // handle null
+  if ( BOSL_OBJECT_VALUE_NULL == value->value_type ) {
+    return false;
+  }
+  // evaluate boolean
+  if ( BOSL_OBJECT_VALUE_BOOL == value->value_type ) {
+    return value->boolean;
+  }
+  // everything else is true
+  return true;
+}
+
+/**
+ * @brief Helper to check whether two values are equal
+ *
+ * @param left
+ * @param right
+ * @return
+ *
+ * @todo Add change depending on type
+ * @todo float and integer comparison shall be not equal
+ * @todo integer and unsigned integer shall be equal when both values are comparable and equal
+ */
+bool bosl_value_equal( bosl_value_t* left, bosl_value_t* right ) {
+  // different value types are never equal
+  if ( left->value_type != right->value_type ) {
+    return false;
+  }
+  // compare payload
+  switch ( left->value_type ) {
+    case BOSL_OBJECT_VALUE_NULL:
+      return true;
+    case BOSL_OBJECT_VALUE_BOOL:
+      return left->boolean == right->boolean;
+    case BOSL_OBJECT_VALUE_FLOAT:
+      return left->float_number == right->float_number;
+    case BOSL_OBJECT_VALUE_INT_SIGNED:
+    case BOSL_OBJECT_VALUE_INT_UNSIGNED:
+      return left->unsigned_number == right->unsigned_number;
+    default:
+      return 0 == memcmp(
+        left->object->data,
+        right->object->data,
+        right->object->size > left->object->size
+          ? left->object->size
+          : right->object->size
+      );
+  }
+}
+
+/**
+ * @brief Helper to extract number from value treated as given value type
+ *
+ * @param value
+ * @param value_type
+ * @param unsigned_number
+ * @param signed_number
+ * @param float_number
+ * @return
+ */
+static bool extract_number_as(
+  bosl_value_t* value,
+  bosl_object_value_type_t value_type,
+  uint64_t* unsigned_number,
+  int64_t* signed_number,
+  long double* float_number
+) {
+  // extract number with own value type
+  if ( !bosl_value_extract_number(
+    value,
+    unsigned_number,
+    signed_number,
+    float_number
+  ) ) {
+    return false;
+  }
+  // convert to signed if requested
+  if (
+    BOSL_OBJECT_VALUE_INT_SIGNED == value_type
+    && value_type != value->value_type
+  ) {
+    if ( BOSL_OBJECT_VALUE_FLOAT == value->value_type ) {
+      *signed_number = ( int64_t )*float_number;
+    } else {
+      *signed_number = ( int64_t )*unsigned_number;
+    }
+  }
+  // return success
+  return true;
+}
+
+/**
+ * @brief Helper to set a boolean result
+ *
+ * @param result
+ * @param flag
+ */
+static void set_bool( bosl_value_t* result, bool flag ) {
+  result->value_type = BOSL_OBJECT_VALUE_BOOL;
+  result->type = BOSL_OBJECT_TYPE_BOOL;
+  result->environment = false;
+  result->boolean = flag;
+}
+
+/**
+ * @brief Helper to check whether operator is a comparison
+ *
+ * @param operator
+ * @return
+ */
+static bool is_comparison( bosl_token_t* operator ) {
+  return TOKEN_BANG_EQUAL == operator->type
+    || TOKEN_EQUAL_EQUAL == operator->type
+    || TOKEN_GREATER == operator->type
+    || TOKEN_GREATER_EQUAL == operator->type
+    || TOKEN_LESS == operator->type
+    || TOKEN_LESS_EQUAL == operator->type;
+}
+
+/**
+ * @brief Helper to extract left and right value as numbers of same type
+ *
+ * @param operator
+ * @param left
+ * @param right
+ * @param type
+ * @param left_number
+ * @param right_number
+ * @return
+ *
+ * @note left and right are released on error
+ */
+static bool number_operand(
+  bosl_token_t* operator,
+  bosl_value_t* left,
+  bosl_value_t* right,
+  bosl_object_value_type_t* type,
+  value_number_t* left_number,
+  value_number_t* right_number
+) {
+  // value types used for operation
+  bosl_object_value_type_t left_value_type = left->value_type;
+  bosl_object_value_type_t right_value_type = right->value_type;
+  // enforce same type and number
+  if ( left_value_type != right_value_type ) {
+    if ( BOSL_OBJECT_VALUE_INT_SIGNED == left_value_type ) {
+      // treat right as signed if left is signed
+      right_value_type = left_value_type;
+    } else if ( BOSL_OBJECT_VALUE_INT_SIGNED == right_value_type ) {
+      // treat left as signed if right is signed
+      left_value_type = right_value_type;
+    } else {
+      bosl_interpreter_emit_error( operator, "Different types for binary." );
+      bosl_value_release( left );
+      bosl_value_release( right );
+      return false;
+    }
+  }
+  // clear out numbers
+  memset( left_number, 0, sizeof( value_number_t ) );
+  memset( right_number, 0, sizeof( value_number_t ) );
+  // extract stuff
+  if (
+    !extract_number_as( left, left_value_type, &left_number->unsigned_number,
+      &left_number->signed_number, &left_number->float_number )
+    || !extract_number_as( right, right_value_type, &right_number->unsigned_number,
+      &right_number->signed_number, &right_number->float_number )
+  ) {
+    bosl_interpreter_emit_error( operator, "Number extraction failed." );
+    bosl_value_release( left );
+    bosl_value_release( right );
+    return false;
+  }
+  // set common type
+  *type = left_value_type;
+  // return success
+  return true;
+}
+
+/**
+ * @brief Compare left and right value without building a result value
+ *
+ * @param operator
+ * @param left
+ * @param right
+ * @param flag
+ * @return
+ *
+ * @note left and right are released and mustn't be used afterwards
+ *
+ * @todo raise error for <, <=, >, >= when types are not comparable, e.g. integer and double
+ */
+bool bosl_value_compare(
+  bosl_token_t* operator,
+  bosl_value_t* left,
+  bosl_value_t* right,
+  bool* flag
+) {
+  // handle equality which is possible for all types
+  if (
+    TOKEN_BANG_EQUAL == operator->type
+    || TOKEN_EQUAL_EQUAL == operator->type
+  ) {
+    // get equality status
+    bool equal = bosl_value_equal( left, right );
+    // release values
+    bosl_value_release( left );
+    bosl_value_release( right );
+    // set result
+    *flag = TOKEN_BANG_EQUAL == operator->type ? !equal : equal;
+    return true;
+  }
+  // handle no comparison
+  if ( !is_comparison( operator ) ) {
+    bosl_interpreter_emit_error( operator, "Unknown comparison token." );
+    bosl_value_release( left );
+    bosl_value_release( right );
+    return false;
+  }
+  // extract numbers of same type
+  bosl_object_value_type_t type;
+  value_number_t left_number;
+  value_number_t right_number;
+  if ( !number_operand( operator, left, right, &type, &left_number, &right_number ) ) {
+    return false;
+  }
+  // compare by float, unsigned or signed integer
+  int comparison;
+  if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
+    comparison = ( left_number.float_number > right_number.float_number )
+      - ( left_number.float_number < right_number.float_number );
+  } else if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
+    comparison = ( left_number.unsigned_number > right_number.unsigned_number )
+      - ( left_number.unsigned_number < right_number.unsigned_number );
+  } else if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
+    comparison = ( left_number.signed_number > right_number.signed_number )
+      - ( left_number.signed_number < right_number.signed_number );
+  } else {
+    // unsupported
+    bosl_interpreter_emit_error( operator, "Unknown error" );
+    return false;
+  }
+  // determine result
+  switch ( operator->type ) {
+    case TOKEN_GREATER: *flag = 0 < comparison; break;
+    case TOKEN_GREATER_EQUAL: *flag = 0 <= comparison; break;
+    case TOKEN_LESS: *flag = 0 > comparison; break;
+    default: *flag = 0 >= comparison; break;
+  }
+  return true;
+}
+
+/**
+ * @brief Apply binary operator to left and right value
+ *
+ * @param operator
+ * @param left
+ * @param right
+ * @param result
+ * @return
+ *
+ * @note left and right are released and mustn't be used afterwards
+ *
+ * @todo add type checking when performing addition, subtraction, division or multiplication
+ */
+bool bosl_value_binary(
+  bosl_token_t* operator,
+  bosl_value_t* left,
+  bosl_value_t* right,
+  bosl_value_t* result
+) {
+  // handle comparison which results in a bool
+  if ( is_comparison( operator ) ) {
+    bool flag;
+    if ( !bosl_value_compare( operator, left, right, &flag ) ) {
+      return false;
+    }
+    set_bool( result, flag );
+    return true;
+  }
+  // extract numbers of same type
+  bosl_object_value_type_t type;
+  value_number_t left_number;
+  value_number_t right_number;
+  if ( !number_operand( operator, left, right, &type, &left_number, &right_number ) ) {
+    return false;
+  }
+  // save types, numbers don't need to be released
+  bosl_object_type_t left_type = left->type;
+  bosl_object_type_t right_type = right->type;
+  // results are never part of an environment
+  result->environment = false;
+
+  // apply arithmetic operator
+  if (
+    TOKEN_MINUS == operator->type
+    || TOKEN_PLUS == operator->type
+    || TOKEN_SLASH == operator->type
+    || TOKEN_STAR == operator->type
+  ) {
+    // handle division by zero for integers
+    if (
+      TOKEN_SLASH == operator->type
+      && (
+        ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type && 0 == right_number.unsigned_number )
+        || ( BOSL_OBJECT_VALUE_INT_SIGNED == type && 0 == right_number.signed_number )
+      )
+    ) {
+      bosl_interpreter_emit_error( operator, "Division by zero." );
+      return false;
+    }
+    // handle float
+    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
+      switch ( operator->type ) {
+        case TOKEN_MINUS: result->float_number = left_number.float_number - right_number.float_number; break;
+        case TOKEN_PLUS: result->float_number = left_number.float_number + right_number.float_number; break;
+        case TOKEN_SLASH: result->float_number = left_number.float_number / right_number.float_number; break;
+        default: result->float_number = left_number.float_number * right_number.float_number; break;
+      }
+      result->value_type = BOSL_OBJECT_VALUE_FLOAT;
+      result->type = BOSL_OBJECT_TYPE_FLOAT;
+      return true;
+    }
+    // handle unsigned int / hex
+    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
+      switch ( operator->type ) {
+        case TOKEN_MINUS: result->unsigned_number = left_number.unsigned_number - right_number.unsigned_number; break;
+        case TOKEN_PLUS: result->unsigned_number = left_number.unsigned_number + right_number.unsigned_number; break;
+        case TOKEN_SLASH: result->unsigned_number = left_number.unsigned_number / right_number.unsigned_number; break;
+        default: result->unsigned_number = left_number.unsigned_number * right_number.unsigned_number; break;
+      }
+      result->value_type = type;
+      result->type = BOSL_OBJECT_TYPE_UINT_64;
+      return true;
+    }
+    // handle signed int / hex
+    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
+      switch ( operator->type ) {
+        case TOKEN_MINUS: result->signed_number = left_number.signed_number - right_number.signed_number; break;
+        case TOKEN_PLUS: result->signed_number = left_number.signed_number + right_number.signed_number; break;
+        case TOKEN_SLASH: result->signed_number = left_number.signed_number / right_number.signed_number; break;
+        default: result->signed_number = left_number.signed_number * right_number.signed_number; break;
+      }
+      result->value_type = type;
+      result->type = BOSL_OBJECT_TYPE_INT_64;
+      return true;
+    }
+    // unsupported
+    bosl_interpreter_emit_error( operator, "Unknown error" );
+    return false;
+  }
+  // apply shift operator
+  if (
+    TOKEN_SHIFT_LEFT == operator->type
+    || TOKEN_SHIFT_RIGHT == operator->type
+  ) {
+    // handle only valid types
+    if (
+      BOSL_OBJECT_TYPE_UINT_8 > left_type
+      || BOSL_OBJECT_TYPE_INT_64 < left_type
+      || BOSL_OBJECT_TYPE_UINT_8 > right_type
+      || BOSL_OBJECT_TYPE_INT_64 < right_type
+    ) {
+      bosl_interpreter_emit_error( operator, "Shifting is restricted to integers." );
+      return false;
+    }
+    // determine max shift bit
+    size_t max_bit = 0;
+    switch ( left_type ) {
+      case BOSL_OBJECT_TYPE_INT_8:
+      case BOSL_OBJECT_TYPE_UINT_8:
+        max_bit = 8;
+        break;
+      case BOSL_OBJECT_TYPE_INT_16:
+      case BOSL_OBJECT_TYPE_UINT_16:
+        max_bit = 16;
+        break;
+      case BOSL_OBJECT_TYPE_INT_32:
+      case BOSL_OBJECT_TYPE_UINT_32:
+        max_bit = 32;
+        break;
+      case BOSL_OBJECT_TYPE_INT_64:
+      case BOSL_OBJECT_TYPE_UINT_64:
+        max_bit = 64;
+        break;
+      default:
+        bosl_interpreter_emit_error( operator, "Unknown left type" );
+        return false;
+    }
+    // handle invalid shift count
+    if (
+      (
+        BOSL_OBJECT_VALUE_INT_UNSIGNED == type
+        && max_bit <= ( size_t )right_number.unsigned_number
+      ) || (
+        BOSL_OBJECT_VALUE_INT_SIGNED == type
+        && (
+          max_bit <= ( size_t )right_number.signed_number
+          || 0 >= right_number.signed_number
+        )
+      ) ) {
+      char message[ 64 ];
+      snprintf(
+        message,
+        sizeof( message ),
+        "Bit amount to shift has to be positive and smaller than %zd.",
+        max_bit
+      );
+      bosl_interpreter_emit_error( operator, message );
+      return false;
+    }
+    // handle unsigned int / hex
+    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
+      if ( TOKEN_SHIFT_LEFT == operator->type ) {
+        result->unsigned_number = left_number.unsigned_number << right_number.unsigned_number;
+      } else {
+        result->unsigned_number = left_number.unsigned_number >> right_number.unsigned_number;
+      }
+      result->value_type = type;
+      result->type = BOSL_OBJECT_TYPE_UINT_64;
+      return true;
+    }
+    // handle signed int / hex
+    if ( BOSL_OBJECT_VALUE_INT_SIGNED == type ) {
+      if ( TOKEN_SHIFT_LEFT == operator->type ) {
+        result->signed_number = left_number.signed_number << right_number.signed_number;
+      } else {
+        result->signed_number = left_number.signed_number >> right_number.signed_number;
+      }
+      result->value_type = type;
+      result->type = BOSL_OBJECT_TYPE_INT_64;
+      return true;
+    }
+    // unsupported
+    bosl_interpreter_emit_error( operator, "Unknown error" );
+    return false;
+  }
+  // raise error and return false
+  bosl_interpreter_emit_error( operator, "Unknown binary token." );
+  // anything else is an error
+  return false;
+}
+
+/**
+ * @brief Apply unary operator to right value
+ *
+ * @param operator
+ * @param right
+ * @param result
+ * @return
+ *
+ * @note right is released and mustn't be used afterwards
+ *
+ * @todo consider types correctly
+ */
+bool bosl_value_unary(
+  bosl_token_t* operator,
+  bosl_value_t* right,
+  bosl_value_t* result
+) {
+  // apply operators
+  if ( TOKEN_BANG == operator->type ) {
+    // truthy flag
+    bool flag = bosl_value_is_truthy( right );
+    // release value
+    bosl_value_release( right );
+    // set result
+    set_bool( result, !flag );
+    return true;
+  } else if ( TOKEN_MINUS == operator->type ) {
+    // validate type
+    if ( right->value_type > BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
+      bosl_interpreter_emit_error( operator, "Expect numeric" );
+      bosl_value_release( right );
+      return false;
+    }
+    // minus unary is only possible for signed values
+    bosl_object_value_type_t type = right->value_type;
+    if ( BOSL_OBJECT_VALUE_INT_UNSIGNED == type ) {
+      // handle incompatible environment variables
+      if (
+        right->environment
+        && (
+          BOSL_OBJECT_TYPE_INT_8 > right->type
+          || BOSL_OBJECT_TYPE_INT_64 < right->type
+        ) ) {
+        bosl_interpreter_emit_error( operator, "Expected signed variable." );
+        return false;
+      }
+      // treat it as the largest possible signed integer
+      type = BOSL_OBJECT_VALUE_INT_SIGNED;
+    }
+    // variables for values
+    int64_t signed_number = 0;
+    uint64_t unsigned_number = 0;
+    long double float_number = 0;
+    // extract stuff
+    if ( !extract_number_as( right, type, &unsigned_number, &signed_number, &float_number ) ) {
+      bosl_interpreter_emit_error(
+        operator, "Runtime error unable to extract number" );
+      return false;
+    }
+    // apply negotiation
+    result->environment = false;
+    result->value_type = type;
+    if ( BOSL_OBJECT_VALUE_FLOAT == type ) {
+      result->type = BOSL_OBJECT_TYPE_FLOAT;
+      result->float_number = -float_number;
+      return true;
+    }
+    result->type = BOSL_OBJECT_TYPE_INT_64;
+    result->signed_number = -signed_number;
+    return true;
+  } else if ( TOKEN_PLUS == operator->type ) {
+    // validate type
+    if ( right->value_type > BOSL_OBJECT_VALUE_INT_UNSIGNED ) {
+      bosl_interpreter_emit_error( operator, "Expect numeric" );
+      bosl_value_release( right );
+      return false;
+    }
+    // just return right
+    *result = *right;
+    return true;
+  } else if ( TOKEN_BINARY_ONE_COMPLEMENT == operator->type ) {
+    // validate type
+    if (
+      BOSL_OBJECT_VALUE_INT_SIGNED != right->value_type
+      && BOSL_OBJECT_VALUE_INT_UNSIGNED != right->value_type
+    ) {
+      bosl_interpreter_emit_error( operator, "Expect numeric integer" );
+      bosl_value_release( right );
+      return false;
+    }
+    // apply complement
+    result->environment = false;
+    result->value_type = right->value_type;
+    if ( BOSL_OBJECT_VALUE_INT_SIGNED == right->value_type ) {
+      result->type = BOSL_OBJECT_TYPE_INT_64;
+      result->signed_number = ~right->signed_number;
+      return true;
+    }
+    result->type = BOSL_OBJECT_TYPE_UINT_64;
+    result->unsigned_number = ~right->unsigned_number;
+    return true;
+  }
+  // release right
+  bosl_value_release( right );
+  // raise error and return false
+  bosl_interpreter_emit_error( operator, "Unknown unary token." );
+  // anything else is an error
+  return false;
+}
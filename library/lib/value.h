@@ -0,0 +1,87 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "scanner.h"
+  #include "object.h"
+  #include "ast/expression.h"
+  #include "collection/arena.h"
+#else
+  #include <bosl/scanner.h>
+  #include <bosl/object.h>
+  #include <bosl/ast/expression.h>
+  #include <bosl/collection/arena.h>
+#endif
+
+#if !defined( BOSL_VALUE_H )
+#define BOSL_VALUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Value passed by value through expression evaluation. Numbers and booleans
+ * are stored inline, only strings and callables refer to a heap object which
+ * is owned by the value unless it's part of an environment.
+ */
+typedef struct bosl_value {
+  bosl_object_value_type_t value_type;
+  bosl_object_type_t type;
+  bool environment;
+  union {
+    bool boolean;
+    uint64_t unsigned_number;
+    int64_t signed_number;
+    long double float_number;
+    bosl_object_t* object;
+  };
+} bosl_value_t;
+
+bool bosl_value_from_literal( bosl_ast_expression_literal_t*, bosl_value_t* );
+void bosl_value_from_object( bosl_object_t*, bosl_value_t* );
+void bosl_value_unbox( bosl_object_t*, bosl_value_t* );
+bosl_object_t* bosl_value_box( bosl_value_t* );
+bool bosl_value_own( bosl_value_t* );
+void bosl_value_release( bosl_value_t* );
+
+bool bosl_value_extract_number(
+  bosl_value_t*, uint64_t*, int64_t*, long double* );
+char* bosl_value_stringify( bosl_value_t* );
+char* bosl_value_stringify_arena( bosl_value_t*, arena_t* );
+bool bosl_value_validate( bosl_token_t*, bosl_object_type_t, bosl_value_t* );
+bool bosl_value_convert( bosl_token_t*, bosl_object_type_t, bosl_value_t* );
+bool bosl_value_store( bosl_object_t*, bosl_value_t* );
+bool bosl_value_is_truthy( bosl_value_t* );
+bool bosl_value_equal( bosl_value_t*, bosl_value_t* );
+bool bosl_value_compare(
+  bosl_token_t*, bosl_value_t*, bosl_value_t*, bool* );
+bool bosl_value_binary(
+  bosl_token_t*, bosl_value_t*, bosl_value_t*, bosl_value_t* );
+bool bosl_value_unary( bosl_token_t*, bosl_value_t*, bosl_value_t* );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,848 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "vm.h"
+#include "environment.h"
+#include "binding.h"
+#include "error.h"
+
+// macro to calculate enlarged capacity
+#define VM_ENLARGE_CAPACITY( c ) ( 16 > ( c ) ? 16 : ( c ) * 2 )
+
+static bosl_vm_t* vm = NULL;
+
+/**
+ * @brief Helper to read operand at instruction pointer
+ *
+ * @param ip
+ * @return
+ */
+static inline uint32_t read_operand( size_t* ip ) {
+  uint32_t operand = bosl_chunk_read_operand( vm->chunk, *ip );
+  *ip += BOSL_CHUNK_OPERAND_SIZE;
+  return operand;
+}
+
+/**
+ * @brief Helper to read token operand at instruction pointer
+ *
+ * @param ip
+ * @return
+ */
+static inline bosl_token_t* read_token( size_t* ip ) {
+  return vm->chunk->token[ read_operand( ip ) ];
+}
+
+/**
+ * @brief Helper to decode a skipped token operand
+ *
+ * @param offset
+ * @return
+ *
+ * @note used by error paths only, so that token operands are skipped otherwise
+ */
+static bosl_token_t* token_at( size_t offset ) {
+  return vm->chunk->token[ bosl_chunk_read_operand( vm->chunk, offset ) ];
+}
+
+/**
+ * @brief Helper to read a scope depth operand
+ *
+ * @param ip
+ * @return
+ */
+static inline size_t read_depth( size_t* ip ) {
+  uint32_t depth = read_operand( ip );
+  // map truncated unresolved depth back
+  return UINT32_MAX == depth ? BOSL_ENVIRONMENT_UNRESOLVED : depth;
+}
+
+/**
+ * @brief Helper to get a variable
+ *
+ * @param depth
+ * @param slot
+ * @param name offset of token operand
+ * @return
+ */
+static bosl_object_t* get_variable( size_t depth, size_t slot, size_t name ) {
+  bosl_environment_t* environment = vm->interpreter->env;
+  // walk up to resolved environment
+  if ( BOSL_ENVIRONMENT_UNRESOLVED != depth ) {
+    for ( size_t level = depth; environment && level; level-- ) {
+      environment = environment->enclosing;
+    }
+    // return if something is there
+    if (
+      environment
+      && slot < environment->slot_count
+      && environment->slot[ slot ]
+    ) {
+      return environment->slot[ slot ];
+    }
+  }
+  // let environment raise the error with decoded name
+  return bosl_environment_get_value(
+    vm->interpreter->env, depth, slot, token_at( name ) );
+}
+
+/**
+ * @brief Enlarge stack
+ *
+ * @return
+ */
+static bool stack_enlarge( void ) {
+  size_t capacity = VM_ENLARGE_CAPACITY( vm->stack_capacity );
+  bosl_value_t* stack = realloc(
+    vm->stack, sizeof( bosl_value_t ) * capacity );
+  if ( !stack ) {
+    bosl_interpreter_emit_error( NULL, "Unable to enlarge stack." );
+    return false;
+  }
+  vm->stack = stack;
+  vm->stack_capacity = capacity;
+  return true;
+}
+
+/**
+ * @brief Push value to stack
+ *
+ * @param value
+ * @return
+ */
+static inline bool push( bosl_value_t* value ) {
+  // enlarge stack if necessary
+  if ( vm->stack_count >= vm->stack_capacity && !stack_enlarge() ) {
+    return false;
+  }
+  // push value
+  vm->stack[ vm->stack_count++ ] = *value;
+  return true;
+}
+
+/**
+ * @brief Push no value marker to stack
+ *
+ * @return
+ */
+static inline bool push_void( void ) {
+  bosl_value_t value = { .value_type = BOSL_OBJECT_VALUE_VOID };
+  return push( &value );
+}
+
+/**
+ * @brief Pop value from stack
+ *
+ * @return
+ *
+ * @note returned slot is valid until next push
+ */
+static inline bosl_value_t* pop( void ) {
+  return &vm->stack[ --vm->stack_count ];
+}
+
+/**
+ * @brief Truncate stack to given size and release values
+ *
+ * @param count
+ */
+static void truncate_stack( size_t count ) {
+  while ( vm->stack_count > count ) {
+    bosl_value_release( &vm->stack[ --vm->stack_count ] );
+  }
+}
+
+/**
+ * @brief Push new nested scope
+ *
+ * @param slot_count
+ * @return
+ */
+static bool scope_push( size_t slot_count ) {
+  // create new nested environment
+  bosl_environment_t* inner = bosl_environment_init_arena(
+    vm->interpreter->arena, vm->interpreter->env, slot_count );
+  if ( !inner ) {
+    bosl_interpreter_emit_error( NULL, "Unable to allocate nested environment." );
+    return false;
+  }
+  // overwrite current env
+  vm->interpreter->env = inner;
+  return true;
+}
+
+/**
+ * @brief Pop nested scope
+ */
+static void scope_pop( void ) {
+  bosl_environment_t* inner = vm->interpreter->env;
+  // restore enclosing environment
+  vm->interpreter->env = inner->enclosing;
+  // destroy nested environment
+  bosl_environment_free( inner );
+}
+
+/**
+ * @brief Leave current function frame
+ */
+static void frame_leave( void ) {
+  bosl_vm_frame_t* frame = &vm->frame[ --vm->frame_count ];
+  // leave all nested scopes of the function
+  while ( vm->interpreter->env != frame->closure ) {
+    scope_pop();
+  }
+  // restore environment and destroy closure
+  vm->interpreter->env = frame->env;
+  bosl_environment_free( frame->closure );
+  // release callee and everything above
+  truncate_stack( frame->base );
+  // continue after call
+  vm->ip = frame->return_address;
+}
+
+/**
+ * @brief Argument list cleanup helper
+ *
+ * @param item
+ */
+static void argument_list_cleanup( void* item ) {
+  bosl_object_release( item );
+}
+
+/**
+ * @brief Helper to call a bound c function
+ *
+ * @param base
+ * @param count
+ * @return
+ */
+static bool call_binding( size_t base, uint32_t count ) {
+  bosl_object_t* object = vm->stack[ base ].object;
+  bosl_ast_statement_function_t* statement =
+    ( ( bosl_object_callable_t* )object->data )->statement;
+  // try to get binding
+  bosl_object_t* binding = bosl_binding_get_atom(
+    statement->load_identifier->atom );
+  // handle no binding
+  if ( !binding ) {
+    bosl_interpreter_emit_error( statement->load_identifier, "Function binding not found." );
+    return false;
+  }
+  // handle invalid binding
+  if ( binding->value_type != BOSL_OBJECT_VALUE_CALLABLE ) {
+    bosl_interpreter_emit_error( statement->load_identifier, "Function binding is not a callable." );
+    return false;
+  }
+  // build list of arguments
+  vector_t* argument_list = vector_construct( argument_list_cleanup );
+  if ( !argument_list ) {
+    bosl_interpreter_emit_error( NULL, "Unable to allocate list for arguments." );
+    return false;
+  }
+  // box arguments into list
+  for ( uint32_t index = 1; index <= count; index++ ) {
+    bosl_value_t* value = &vm->stack[ base + index ];
+    bosl_object_t* parameter = bosl_value_box( value );
+    if ( !parameter ) {
+      bosl_interpreter_emit_error( NULL, "Unable to push back parameter object." );
+      vector_destruct( argument_list );
+      return false;
+    }
+    // value has been moved into parameter
+    value->value_type = BOSL_OBJECT_VALUE_VOID;
+    if ( !vector_push_back( argument_list, parameter ) ) {
+      bosl_object_release( parameter );
+      bosl_interpreter_emit_error( NULL, "Unable to push back parameter object." );
+      vector_destruct( argument_list );
+      return false;
+    }
+  }
+  // call binding
+  bosl_object_callable_t* binding_callable = binding->data;
+  bosl_object_t* result = binding_callable->callback( object, argument_list );
+  // destroy argument list and callee
+  vector_destruct( argument_list );
+  truncate_stack( base );
+  // handle error
+  if ( vm->interpreter->error ) {
+    bosl_object_release( result );
+    return false;
+  }
+  // handle no result
+  if ( !result ) {
+    return push_void();
+  }
+  // unbox and push result
+  bosl_value_t value;
+  bosl_value_unbox( result, &value );
+  if ( !push( &value ) ) {
+    bosl_value_release( &value );
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to call a script function
+ *
+ * @param base
+ * @param count
+ * @return
+ */
+static bool call_function( size_t base, uint32_t count ) {
+  bosl_object_callable_t* callable = vm->stack[ base ].object->data;
+  bosl_ast_statement_function_t* statement = callable->statement;
+  // create new closure environment
+  bosl_environment_t* closure = bosl_environment_init_arena(
+    vm->interpreter->arena, callable->closure, statement->slot_count );
+  if ( !closure ) {
+    bosl_interpreter_emit_error( NULL, "Unable to allocate closure for function execution." );
+    return false;
+  }
+  // push parameter to environment
+  for ( uint32_t index = 1; index <= count; index++ ) {
+    bosl_ast_statement_t* argument = vector_at( statement->parameter, index - 1 );
+    bosl_value_t* value = &vm->stack[ base + index ];
+    // push to environment which consumes the value
+    bool pushed = bosl_object_assign_push_value(
+      closure,
+      0,
+      argument->parameter->slot,
+      argument->parameter->name,
+      argument->parameter->type,
+      value,
+      false,
+      true
+    );
+    value->value_type = BOSL_OBJECT_VALUE_VOID;
+    if ( !pushed ) {
+      bosl_environment_free( closure );
+      bosl_interpreter_emit_error( NULL, "Unable to get parameter value for callable." );
+      return false;
+    }
+  }
+  // enlarge frames if necessary
+  if ( vm->frame_count >= vm->frame_capacity ) {
+    size_t capacity = VM_ENLARGE_CAPACITY( vm->frame_capacity );
+    bosl_vm_frame_t* frame = realloc(
+      vm->frame, sizeof( bosl_vm_frame_t ) * capacity );
+    if ( !frame ) {
+      bosl_environment_free( closure );
+      bosl_interpreter_emit_error( NULL, "Unable to enlarge call frames." );
+      return false;
+    }
+    vm->frame = frame;
+    vm->frame_capacity = capacity;
+  }
+  // populate frame
+  bosl_vm_frame_t* frame = &vm->frame[ vm->frame_count++ ];
+  frame->return_address = vm->ip;
+  frame->base = base;
+  frame->env = vm->interpreter->env;
+  frame->closure = closure;
+  frame->statement = statement;
+  // drop moved arguments and switch to function
+  vm->stack_count = base + 1;
+  vm->interpreter->env = closure;
+  vm->ip = callable->entry;
+  return true;
+}
+
+/**
+ * @brief Helper to perform a call
+ *
+ * @param count
+ * @param paren offset of token operand
+ * @return
+ */
+static bool call( uint32_t count, size_t paren ) {
+  size_t base = vm->stack_count - count - 1;
+  bosl_value_t* callee = &vm->stack[ base ];
+  // handle error
+  if ( BOSL_OBJECT_VALUE_VOID == callee->value_type ) {
+    bosl_interpreter_emit_error( token_at( paren ), "Unable to evaluate callee expression." );
+    return false;
+  }
+  // handle not a callable
+  if (
+    BOSL_OBJECT_VALUE_CALLABLE != callee->value_type
+    || !( ( bosl_object_callable_t* )callee->object->data )->statement
+  ) {
+    bosl_interpreter_emit_error( token_at( paren ), "Not a callable function." );
+    return false;
+  }
+  bosl_ast_statement_function_t* statement =
+    ( ( bosl_object_callable_t* )callee->object->data )->statement;
+  // validate and duplicate arguments
+  for ( uint32_t index = 1; index <= count; index++ ) {
+    if ( BOSL_OBJECT_VALUE_VOID == vm->stack[ base + index ].value_type ) {
+      bosl_interpreter_emit_error(
+        token_at( paren ), "Unable to evaluate parameter expression." );
+      return false;
+    }
+    if ( !bosl_value_own( &vm->stack[ base + index ] ) ) {
+      bosl_interpreter_emit_error(
+        token_at( paren ), "Unable to duplicate parameter object." );
+      return false;
+    }
+  }
+  // check amount of passed arguments
+  if ( vector_size( statement->parameter ) != count ) {
+    bosl_interpreter_emit_error(
+      token_at( paren ),
+      "Argument mismatch, to less or much parameters passed."
+    );
+    return false;
+  }
+  // call binding or function
+  if ( statement->load_identifier ) {
+    return call_binding( base, count );
+  }
+  return call_function( base, count );
+}
+
+/**
+ * @brief Helper to return from function
+ *
+ * @param value
+ * @return
+ */
+static bool function_return( bosl_value_t* value ) {
+  // handle return outside of function
+  if ( !vm->frame_count ) {
+    bosl_value_release( value );
+    bosl_interpreter_emit_error( NULL, "Return outside of function." );
+    return false;
+  }
+  bosl_vm_frame_t* frame = &vm->frame[ vm->frame_count - 1 ];
+  // handle return value
+  if ( BOSL_OBJECT_VALUE_VOID != value->value_type ) {
+    // duplicate if environment object
+    if ( !bosl_value_own( value ) ) {
+      bosl_interpreter_emit_error( NULL, "Unable to duplicate return object after function." );
+      return false;
+    }
+    // validate return
+    if ( !bosl_value_validate( frame->statement->return_type, value->type, value ) ) {
+      bosl_value_release( value );
+      bosl_interpreter_emit_error(
+        frame->statement->return_type,
+        "Invalid return value received."
+      );
+      return false;
+    }
+  }
+  // leave function
+  frame_leave();
+  // push return value
+  if ( !push( value ) ) {
+    bosl_value_release( value );
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Helper to break or continue with runtime level
+ *
+ * @param is_break
+ * @return
+ */
+static bool break_continue( bool is_break ) {
+  size_t token = vm->ip;
+  vm->ip += BOSL_CHUNK_OPERAND_SIZE;
+  uint32_t count = read_operand( &vm->ip );
+  // get level
+  bosl_value_t level = *pop();
+  if ( BOSL_OBJECT_VALUE_VOID == level.value_type ) {
+    bosl_interpreter_emit_error(
+      token_at( token ),
+      is_break
+        ? "Unable to evaluate break condition."
+        : "Unable to evaluate continue condition."
+    );
+    return false;
+  }
+  // validate level
+  if ( !bosl_value_validate( NULL, BOSL_OBJECT_TYPE_INT_8, &level ) ) {
+    bosl_value_release( &level );
+    bosl_interpreter_emit_error(
+      token_at( token ),
+      is_break
+        ? "Break level has to be of type signed integer."
+        : "Continue level has to be of type signed integer."
+    );
+    return false;
+  }
+  // get level value
+  int64_t val = level.signed_number;
+  // handle invalid value
+  if ( 0 >= val ) {
+    bosl_interpreter_emit_error(
+      token_at( token ),
+      is_break
+        ? "Break level has to be positive."
+        : "Continue level has to be positive."
+    );
+    return false;
+  }
+  // handle more levels than loops are existing
+  if ( val > count ) {
+    bosl_interpreter_emit_error(
+      token_at( token ),
+      is_break ? "Break statement to high." : "Continue statement to high."
+    );
+    return false;
+  }
+  // get target and scopes to leave from jump table
+  vm->ip += ( size_t )( val - 1 ) * BOSL_CHUNK_OPERAND_SIZE * 2;
+  uint32_t target = read_operand( &vm->ip );
+  uint32_t scope = read_operand( &vm->ip );
+  // leave scopes
+  while ( scope-- ) {
+    scope_pop();
+  }
+  // jump
+  vm->ip = target;
+  return true;
+}
+
+/**
+ * @brief Execute chunk until halt or error
+ *
+ * @return
+ */
+static bool execute( void ) {
+  bosl_interpreter_t* interpreter = vm->interpreter;
+  bosl_chunk_t* chunk = vm->chunk;
+  // instruction pointer is kept local and synced only around calls
+  size_t ip = vm->ip;
+  while ( true ) {
+    uint8_t opcode = chunk->code[ ip++ ];
+    switch ( opcode ) {
+      case BOSL_OPCODE_CONSTANT:
+        // push constant, heap constants are owned by the chunk
+        if ( !push( &chunk->constant[ read_operand( &ip ) ] ) ) {
+          return false;
+        }
+        break;
+      case BOSL_OPCODE_POP:
+        truncate_stack( vm->stack_count - 1 );
+        break;
+      case BOSL_OPCODE_PRINT: {
+        bosl_value_t value = *pop();
+        // handle error
+        if ( BOSL_OBJECT_VALUE_VOID == value.value_type ) {
+          bosl_interpreter_emit_error( NULL, "Evaluate of inner expression for print failed." );
+          return false;
+        }
+        // print via stringify into arena
+        arena_mark_t mark = arena_mark( interpreter->arena );
+        char* str = bosl_value_stringify_arena( &value, interpreter->arena );
+        bosl_value_release( &value );
+        if ( !str ) {
+          arena_reset( interpreter->arena, mark );
+          bosl_interpreter_emit_error( NULL, "Stringify of evaluated object failed." );
+          return false;
+        }
+        // print string
+        fprintf( stdout, "%s\r\n", str );
+        arena_reset( interpreter->arena, mark );
+        break;
+      }
+      case BOSL_OPCODE_GET_VARIABLE: {
+        size_t depth = read_depth( &ip );
+        size_t slot = read_operand( &ip );
+        // name is decoded only on error
+        bosl_object_t* object = get_variable( depth, slot, ip );
+        ip += BOSL_CHUNK_OPERAND_SIZE;
+        // environment raised already an error
+        if ( !object ) {
+          interpreter->error = true;
+          return false;
+        }
+        // value refers to environment object
+        bosl_value_t value;
+        bosl_value_from_object( object, &value );
+        if ( !push( &value ) ) {
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_DEFINE_VARIABLE:
+      case BOSL_OPCODE_DEFINE_CONSTANT: {
+        size_t slot = read_operand( &ip );
+        bosl_token_t* name = read_token( &ip );
+        bosl_token_t* type = read_token( &ip );
+        bool constant = BOSL_OPCODE_DEFINE_CONSTANT == opcode;
+        // evaluated initializer
+        bosl_value_t value = *pop();
+        if ( BOSL_OBJECT_VALUE_VOID == value.value_type ) {
+          bosl_interpreter_emit_error(
+            name,
+            constant
+              ? "Unable to evaluate constant initializer expression."
+              : "Unable to evaluate initializer expression."
+          );
+          return false;
+        }
+        // push to environment
+        if ( !bosl_object_assign_push_value(
+          interpreter->env, 0, slot, name, type, &value, constant, true
+        ) ) {
+          bosl_interpreter_emit_error(
+            name,
+            constant
+              ? "Unable to push constant to environment."
+              : "Unable to push variable to environment."
+          );
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_ASSIGN: {
+        size_t depth = read_depth( &ip );
+        size_t slot = read_operand( &ip );
+        bosl_token_t* name = read_token( &ip );
+        // evaluated value
+        bosl_value_t value = *pop();
+        if ( BOSL_OBJECT_VALUE_VOID == value.value_type ) {
+          bosl_interpreter_emit_error( name, "Unable to evaluate assign expression." );
+          return false;
+        }
+        // assign value
+        if ( !bosl_object_assign_push_value(
+          interpreter->env, depth, slot, name, NULL, &value, false, false
+        ) ) {
+          bosl_interpreter_emit_error( name, "Assignment failed." );
+          return false;
+        }
+        // assignment has no value
+        if ( !push_void() ) {
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_BINARY: {
+        bosl_token_t* operator = read_token( &ip );
+        bosl_value_t right = *pop();
+        bosl_value_t left = *pop();
+        // handle error
+        if (
+          BOSL_OBJECT_VALUE_VOID == left.value_type
+          || BOSL_OBJECT_VALUE_VOID == right.value_type
+        ) {
+          bosl_value_release( &left );
+          bosl_value_release( &right );
+          bosl_interpreter_emit_error(
+            operator,
+            BOSL_OBJECT_VALUE_VOID == left.value_type
+              ? "Unable to evaluate left expression"
+              : "Unable to evaluate right expression"
+          );
+          return false;
+        }
+        // apply operator
+        bosl_value_t result;
+        if (
+          !bosl_value_binary( operator, &left, &right, &result )
+          || !push( &result )
+        ) {
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_UNARY: {
+        bosl_token_t* operator = read_token( &ip );
+        bosl_value_t right = *pop();
+        // handle error
+        if ( BOSL_OBJECT_VALUE_VOID == right.value_type ) {
+          bosl_interpreter_emit_error(
+            operator, "Unable to evaluate right expression" );
+          return false;
+        }
+        // apply operator
+        bosl_value_t result;
+        if (
+          !bosl_value_unary( operator, &right, &result )
+          || !push( &result )
+        ) {
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_JUMP:
+        ip = read_operand( &ip );
+        break;
+      case BOSL_OPCODE_JUMP_IF_FALSE: {
+        uint32_t target = read_operand( &ip );
+        bosl_value_t condition = *pop();
+        // handle error
+        if ( BOSL_OBJECT_VALUE_VOID == condition.value_type ) {
+          bosl_interpreter_emit_error( NULL, "Unable to evaluate condition." );
+          return false;
+        }
+        // evaluate condition
+        bool flag = bosl_value_is_truthy( &condition );
+        bosl_value_release( &condition );
+        if ( !flag ) {
+          ip = target;
+        }
+        break;
+      }
+      case BOSL_OPCODE_OR:
+      case BOSL_OPCODE_AND: {
+        uint32_t target = read_operand( &ip );
+        bosl_value_t* left = &vm->stack[ vm->stack_count - 1 ];
+        // handle error
+        if ( BOSL_OBJECT_VALUE_VOID == left->value_type ) {
+          bosl_interpreter_emit_error( NULL, "Unable to evaluate left side." );
+          return false;
+        }
+        // keep left side as result when short circuiting
+        if ( bosl_value_is_truthy( left ) == ( BOSL_OPCODE_OR == opcode ) ) {
+          ip = target;
+        } else {
+          truncate_stack( vm->stack_count - 1 );
+        }
+        break;
+      }
+      case BOSL_OPCODE_SCOPE_PUSH:
+        if ( !scope_push( read_operand( &ip ) ) ) {
+          return false;
+        }
+        break;
+      case BOSL_OPCODE_SCOPE_POP:
+        scope_pop();
+        break;
+      case BOSL_OPCODE_FUNCTION: {
+        bosl_chunk_function_t* function = &chunk->function[ read_operand( &ip ) ];
+        // allocate callable object
+        bosl_object_t* f = bosl_object_allocate_callable(
+          function->statement, NULL, interpreter->env );
+        if ( !f ) {
+          bosl_interpreter_emit_error(
+            function->statement->token,
+            "Unable to allocate function object."
+          );
+          return false;
+        }
+        ( ( bosl_object_callable_t* )f->data )->entry = function->entry;
+        // push to environment
+        if ( !bosl_environment_push_value(
+          interpreter->env, function->statement->slot, f
+        ) ) {
+          bosl_object_destroy( f );
+          bosl_interpreter_emit_error(
+            function->statement->token,
+            "Unable to allocate function object."
+          );
+          return false;
+        }
+        break;
+      }
+      case BOSL_OPCODE_CALL: {
+        uint32_t count = read_operand( &ip );
+        // parenthesis is decoded only on error
+        vm->ip = ip + BOSL_CHUNK_OPERAND_SIZE;
+        if ( !call( count, ip ) ) {
+          return false;
+        }
+        ip = vm->ip;
+        break;
+      }
+      case BOSL_OPCODE_RETURN: {
+        bosl_value_t value = *pop();
+        // handle error
+        if ( BOSL_OBJECT_VALUE_VOID == value.value_type ) {
+          bosl_interpreter_emit_error( NULL, "Unable to evaluate return expression." );
+          return false;
+        }
+        if ( !function_return( &value ) ) {
+          return false;
+        }
+        ip = vm->ip;
+        break;
+      }
+      case BOSL_OPCODE_RETURN_NOTHING: {
+        bosl_value_t value = { .value_type = BOSL_OBJECT_VALUE_VOID };
+        if ( !function_return( &value ) ) {
+          return false;
+        }
+        ip = vm->ip;
+        break;
+      }
+      case BOSL_OPCODE_BREAK:
+      case BOSL_OPCODE_CONTINUE:
+        vm->ip = ip;
+        if ( !break_continue( BOSL_OPCODE_BREAK == opcode ) ) {
+          return false;
+        }
+        ip = vm->ip;
+        break;
+      case BOSL_OPCODE_HALT:
+        return true;
+      default:
+        bosl_interpreter_emit_error( NULL, "Unknown opcode." );
+        return false;
+    }
+  }
+}
+
+/**
+ * @brief Run chunk with interpreter environment
+ *
+ * @param interpreter
+ * @param chunk
+ * @return
+ */
+bool bosl_vm_run( bosl_interpreter_t* interpreter, bosl_chunk_t* chunk ) {
+  // allocate vm structure
+  vm = malloc( sizeof( bosl_vm_t ) );
+  if ( !vm ) {
+    return false;
+  }
+  // clear out
+  memset( vm, 0, sizeof( bosl_vm_t ) );
+  // populate
+  vm->interpreter = interpreter;
+  vm->chunk = chunk;
+  // backup global environment
+  bosl_environment_t* global = interpreter->env;
+  // execute
+  bool result = execute();
+  // cleanup stack, frames and scopes in case of error
+  truncate_stack( 0 );
+  while ( vm->frame_count ) {
+    frame_leave();
+  }
+  while ( interpreter->env != global ) {
+    scope_pop();
+  }
+  // free vm
+  free( vm->stack );
+  free( vm->frame );
+  free( vm );
+  vm = NULL;
+  // return result
+  return result;
+}
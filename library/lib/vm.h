@@ -0,0 +1,72 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined( _COMPILING_BOSL )
+  #include "interpreter.h"
+  #include "object.h"
+  #include "value.h"
+  #include "bytecode/chunk.h"
+  typedef struct bosl_environment bosl_environment_t;
+#else
+  #include <bosl/interpreter.h>
+  #include <bosl/object.h>
+  #include <bosl/value.h>
+  #include <bosl/bytecode/chunk.h>
+  typedef struct bosl_environment bosl_environment_t;
+#endif
+
+#if !defined( BOSL_VM_H )
+#define BOSL_VM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  size_t return_address;
+  size_t base;
+  bosl_environment_t* env;
+  bosl_environment_t* closure;
+  bosl_ast_statement_function_t* statement;
+} bosl_vm_frame_t;
+
+typedef struct {
+  bosl_interpreter_t* interpreter;
+  bosl_chunk_t* chunk;
+  size_t ip;
+
+  bosl_value_t* stack;
+  size_t stack_count;
+  size_t stack_capacity;
+
+  bosl_vm_frame_t* frame;
+  size_t frame_count;
+  size_t frame_capacity;
+} bosl_vm_t;
+
+bool bosl_vm_run( bosl_interpreter_t*, bosl_chunk_t* );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <check.h>
+#include "../lib/collection/arena.h"
+
+arena_t* arena;
+
+static void setup( void ) {
+  arena = arena_construct();
+  ck_assert_ptr_nonnull( arena );
+}
+
+static void teardown( void ) {
+  arena_destruct( arena );
+  arena = NULL;
+}
+
+START_TEST( test_arena_create ) {
+  ck_assert_ptr_null( arena->chunk );
+  ck_assert_ptr_null( arena->spare );
+  ck_assert_ptr_null( arena->bump );
+  ck_assert_ptr_null( arena->end );
+}
+END_TEST
+
+START_TEST( test_arena_allocate ) {
+  // invalid size
+  ck_assert_ptr_null( arena_allocate( arena, 0 ) );
+  // first allocation starts a chunk
+  uint8_t* a = arena_allocate( arena, 3 );
+  ck_assert_ptr_nonnull( a );
+  ck_assert_ptr_nonnull( arena->chunk );
+  // following allocation is bumped and aligned
+  uint8_t* b = arena_allocate( arena, 5 );
+  ck_assert_ptr_eq( b, a + ARENA_ALIGNMENT );
+  ck_assert_uint_eq( ( uintptr_t )a % ARENA_ALIGNMENT, 0 );
+  ck_assert_uint_eq( ( uintptr_t )b % ARENA_ALIGNMENT, 0 );
+}
+END_TEST
+
+START_TEST( test_arena_oversized ) {
+  arena_allocate( arena, 16 );
+  arena_chunk_t* first = arena->chunk;
+  // oversized allocation gets a dedicated chunk
+  void* large = arena_allocate( arena, ARENA_CHUNK_SIZE * 2 );
+  ck_assert_ptr_nonnull( large );
+  ck_assert_ptr_ne( arena->chunk, first );
+  ck_assert_ptr_eq( arena->chunk->next, first );
+  ck_assert_uint_ge( arena->chunk->size, ARENA_CHUNK_SIZE * 2 );
+}
+END_TEST
+
+START_TEST( test_arena_reset ) {
+  void* a = arena_allocate( arena, 32 );
+  ck_assert_ptr_nonnull( a );
+  // take mark and allocate beyond current chunk
+  arena_mark_t mark = arena_mark( arena );
+  arena_chunk_t* first = arena->chunk;
+  ck_assert_ptr_nonnull( arena_allocate( arena, 64 ) );
+  ck_assert_ptr_nonnull( arena_allocate( arena, ARENA_CHUNK_SIZE ) );
+  ck_assert_ptr_ne( arena->chunk, first );
+  // reset releases allocations after mark
+  arena_reset( arena, mark );
+  ck_assert_ptr_eq( arena->chunk, first );
+  ck_assert_ptr_eq( arena->bump, mark.bump );
+  ck_assert_ptr_nonnull( arena->spare );
+  // next allocation reuses memory after mark
+  ck_assert_ptr_eq( arena_allocate( arena, 64 ), mark.bump );
+}
+END_TEST
+
+START_TEST( test_arena_clear ) {
+  ck_assert_ptr_nonnull( arena_allocate( arena, 128 ) );
+  ck_assert_ptr_nonnull( arena_allocate( arena, ARENA_CHUNK_SIZE ) );
+  // clear keeps chunks as spare
+  arena_clear( arena );
+  ck_assert_ptr_null( arena->chunk );
+  ck_assert_ptr_null( arena->bump );
+  ck_assert_ptr_nonnull( arena->spare );
+  // spare chunk is reused
+  arena_chunk_t* spare = arena->spare;
+  ck_assert_ptr_nonnull( arena_allocate( arena, 16 ) );
+  ck_assert_ptr_eq( arena->chunk, spare );
+}
+END_TEST
+
+static Suite* arena_suite( void ) {
+  Suite* s;
+  TCase* tc_core;
+
+  s = suite_create( "libbosl" );
+  // test cases
+  tc_core = tcase_create( "arena" );
+  // add tests
+  tcase_add_checked_fixture( tc_core, setup, teardown );
+  tcase_add_test( tc_core, test_arena_create );
+  tcase_add_test( tc_core, test_arena_allocate );
+  tcase_add_test( tc_core, test_arena_oversized );
+  tcase_add_test( tc_core, test_arena_reset );
+  tcase_add_test( tc_core, test_arena_clear );
+  suite_add_tcase( s, tc_core );
+  // return suite
+  return s;
+}
+
+int main( void ) {
+  int number_failed;
+  Suite* s;
+  SRunner* sr;
+
+  s = arena_suite();
+  sr = srunner_create( s );
+
+  srunner_run_all( sr, CK_NORMAL );
+  number_failed = srunner_ntests_failed( sr );
+  srunner_free( sr );
+  return ( 0 == number_failed ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <check.h>
+#include "../lib/atom.h"
+#include "../lib/collection/hashmap.h"
+#include "../lib/scanner.h"
+
+static void setup( void ) {
+}
+
+static void teardown( void ) {
+  bosl_scanner_free();
+  bosl_atom_free();
+}
+
+START_TEST( test_atom_none ) {
+  // nothing interned yet
+  ck_assert( BOSL_ATOM_NONE == bosl_atom_find( "foo", 3 ) );
+  ck_assert_ptr_null( bosl_atom_name( BOSL_ATOM_NONE ) );
+  ck_assert( 0 == bosl_atom_length( BOSL_ATOM_NONE ) );
+}
+END_TEST
+
+START_TEST( test_atom_intern ) {
+  // intern by length
+  bosl_atom_t foo = bosl_atom_intern( "foobar", 3 );
+  ck_assert( BOSL_ATOM_NONE != foo );
+  ck_assert_str_eq( bosl_atom_name( foo ), "foo" );
+  ck_assert( 3 == bosl_atom_length( foo ) );
+  ck_assert( hashmap_hash( "foo", 3 ) == bosl_atom_hash( foo ) );
+  // same name results in same atom
+  ck_assert( foo == bosl_atom_intern( "foo", 3 ) );
+  ck_assert( foo == bosl_atom_find( "foo", 3 ) );
+  // different name results in different atom
+  bosl_atom_t bar = bosl_atom_intern( "bar", 3 );
+  ck_assert( BOSL_ATOM_NONE != bar );
+  ck_assert( foo != bar );
+  ck_assert( 3 == bosl_atom_count() );
+}
+END_TEST
+
+START_TEST( test_atom_many ) {
+  char name[ 16 ];
+  // intern enough to grow entries
+  for ( size_t i = 0; i < 1000; i++ ) {
+    snprintf( name, sizeof( name ), "name%zu", i );
+    ck_assert( ( bosl_atom_t )( i + 1 ) == bosl_atom_intern( name, strlen( name ) ) );
+  }
+  // names are still reachable
+  for ( size_t i = 0; i < 1000; i++ ) {
+    snprintf( name, sizeof( name ), "name%zu", i );
+    ck_assert_str_eq( bosl_atom_name( ( bosl_atom_t )( i + 1 ) ), name );
+  }
+}
+END_TEST
+
+START_TEST( test_atom_scanner ) {
+  ck_assert( bosl_scanner_init( "let foo: int32 = foo + bar;" ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+  // collect identifier tokens
+  bosl_token_t* identifier[ 3 ];
+  size_t count = 0;
+  for ( size_t index = 0; index < vector_size( list ); index++ ) {
+    bosl_token_t* token = vector_at( list, index );
+    if ( TOKEN_IDENTIFIER == token->type ) {
+      ck_assert( count < 3 );
+      identifier[ count++ ] = token;
+    } else {
+      ck_assert( BOSL_ATOM_NONE == token->atom );
+    }
+  }
+  ck_assert( 3 == count );
+  // same identifiers share the atom
+  ck_assert( BOSL_ATOM_NONE != identifier[ 0 ]->atom );
+  ck_assert( identifier[ 0 ]->atom == identifier[ 1 ]->atom );
+  ck_assert( identifier[ 0 ]->atom != identifier[ 2 ]->atom );
+  ck_assert_str_eq( bosl_atom_name( identifier[ 2 ]->atom ), "bar" );
+}
+END_TEST
+
+static Suite* atom_suite( void ) {
+  Suite* s;
+  TCase* tc_core;
+
+  s = suite_create( "libbosl" );
+  // test cases
+  tc_core = tcase_create( "atom" );
+  // add tests
+  tcase_add_checked_fixture( tc_core, setup, teardown );
+  tcase_add_test( tc_core, test_atom_none );
+  tcase_add_test( tc_core, test_atom_intern );
+  tcase_add_test( tc_core, test_atom_many );
+  tcase_add_test( tc_core, test_atom_scanner );
+  suite_add_tcase( s, tc_core );
+  // return suite
+  return s;
+}
+
+int main( void ) {
+  int number_failed;
+  Suite* s;
+  SRunner* sr;
+
+  s = atom_suite();
+  sr = srunner_create( s );
+
+  srunner_run_all( sr, CK_NORMAL );
+  number_failed = srunner_ntests_failed( sr );
+  srunner_free( sr );
+  return ( 0 == number_failed ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <check.h>
+#include "../lib/scanner.h"
+#include "../lib/parser.h"
+#include "../lib/compiler.h"
+#include "../lib/resolver.h"
+#include "../lib/bytecode/chunk.h"
+
+static bosl_chunk_t* chunk = NULL;
+
+static void setup( void ) {
+}
+
+static void teardown( void ) {
+  // destroy chunk, scanner, parser and interned names
+  bosl_chunk_destroy( chunk );
+  bosl_scanner_free();
+  bosl_parser_free();
+  bosl_atom_free();
+}
+
+/**
+ * @brief Helper to compile a source
+ *
+ * @param source
+ */
+static void compile( const char* source ) {
+  // init scanner
+  ck_assert( bosl_scanner_init( source ) );
+  // init parser pulling token from scanner
+  ck_assert( bosl_parser_init() );
+  // parse ast
+  vector_t* ast = bosl_parser_scan();
+  ck_assert_ptr_nonnull( ast );
+  // resolve variables
+  size_t global_slots;
+  ck_assert( bosl_resolver_resolve( ast, &global_slots ) );
+  // compile ast
+  chunk = bosl_compiler_compile( ast );
+  ck_assert_ptr_nonnull( chunk );
+}
+
+START_TEST( test_simple_expression ) {
+  compile( "3 + 2 * 7;" );
+  // expected: 3 2 7 * + pop halt
+  size_t offset = 0;
+  bosl_opcode_t expected[] = {
+    BOSL_OPCODE_CONSTANT,
+    BOSL_OPCODE_CONSTANT,
+    BOSL_OPCODE_CONSTANT,
+    BOSL_OPCODE_BINARY,
+    BOSL_OPCODE_BINARY,
+  };
+  for ( size_t index = 0; index < sizeof( expected ) / sizeof( expected[ 0 ] ); index++ ) {
+    ck_assert_int_eq( chunk->code[ offset ], expected[ index ] );
+    offset += 1 + BOSL_CHUNK_OPERAND_SIZE;
+  }
+  ck_assert_int_eq( chunk->code[ offset++ ], BOSL_OPCODE_POP );
+  ck_assert_int_eq( chunk->code[ offset++ ], BOSL_OPCODE_HALT );
+  ck_assert_uint_eq( offset, chunk->count );
+  // check constants and operator order
+  ck_assert_uint_eq( chunk->constant_count, 3 );
+  ck_assert_int_eq( chunk->token[ 0 ]->type, TOKEN_STAR );
+  ck_assert_int_eq( chunk->token[ 1 ]->type, TOKEN_PLUS );
+}
+END_TEST
+
+START_TEST( test_while_break ) {
+  compile( "while ( true ) { break; }" );
+  // condition and exit jump
+  ck_assert_int_eq( chunk->code[ 0 ], BOSL_OPCODE_CONSTANT );
+  ck_assert_int_eq( chunk->code[ 5 ], BOSL_OPCODE_JUMP_IF_FALSE );
+  // body with break leaving the block scope
+  ck_assert_int_eq( chunk->code[ 10 ], BOSL_OPCODE_SCOPE_PUSH );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 11 ), 0 );
+  ck_assert_int_eq( chunk->code[ 15 ], BOSL_OPCODE_SCOPE_POP );
+  ck_assert_int_eq( chunk->code[ 16 ], BOSL_OPCODE_JUMP );
+  ck_assert_int_eq( chunk->code[ 21 ], BOSL_OPCODE_SCOPE_POP );
+  // jump back to condition
+  ck_assert_int_eq( chunk->code[ 22 ], BOSL_OPCODE_JUMP );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 23 ), 0 );
+  // exit jumps are patched to halt
+  ck_assert_int_eq( chunk->code[ 27 ], BOSL_OPCODE_HALT );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 6 ), 27 );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 17 ), 27 );
+}
+END_TEST
+
+START_TEST( test_variable_slot ) {
+  compile( "let a: int32 = 1; { let b: int32 = a; print( b ); }" );
+  // global definition into first slot
+  ck_assert_int_eq( chunk->code[ 5 ], BOSL_OPCODE_DEFINE_VARIABLE );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 6 ), 0 );
+  // block with one slot
+  ck_assert_int_eq( chunk->code[ 18 ], BOSL_OPCODE_SCOPE_PUSH );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 19 ), 1 );
+  // access of global from within block
+  ck_assert_int_eq( chunk->code[ 23 ], BOSL_OPCODE_GET_VARIABLE );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 24 ), 1 );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 28 ), 0 );
+  // access of local variable
+  ck_assert_int_eq( chunk->code[ 49 ], BOSL_OPCODE_GET_VARIABLE );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 50 ), 0 );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 54 ), 0 );
+}
+END_TEST
+
+START_TEST( test_variable_slot_large_scope ) {
+  // exceed inline slots and index threshold in global and block scope
+  static const size_t read[] = { 0, 7, 8, 31, 32, 39 };
+  size_t count = sizeof( read ) / sizeof( read[ 0 ] );
+  static char source[ 4096 ];
+  size_t length = 0;
+  for ( size_t index = 0; index < 40; index++ ) {
+    length += ( size_t )snprintf( source + length, sizeof( source ) - length,
+      "let g%zu: int32 = %zu;", index, index );
+  }
+  length += ( size_t )snprintf(
+    source + length, sizeof( source ) - length, "{" );
+  for ( size_t index = 0; index < 40; index++ ) {
+    length += ( size_t )snprintf( source + length, sizeof( source ) - length,
+      "let l%zu: int32 = %zu;", index, index );
+  }
+  for ( size_t index = 0; index < count; index++ ) {
+    length += ( size_t )snprintf( source + length, sizeof( source ) - length,
+      "print( g%zu ); print( l%zu );", read[ index ], read[ index ] );
+  }
+  snprintf( source + length, sizeof( source ) - length, "}" );
+  ck_assert( length < sizeof( source ) - 1 );
+  compile( source );
+  // definitions get consecutive slots
+  for ( size_t index = 0; index < 40; index++ ) {
+    ck_assert_int_eq( chunk->code[ index * 18 + 5 ], BOSL_OPCODE_DEFINE_VARIABLE );
+    ck_assert_uint_eq( bosl_chunk_read_operand( chunk, index * 18 + 6 ), index );
+    ck_assert_int_eq(
+      chunk->code[ index * 18 + 730 ], BOSL_OPCODE_DEFINE_VARIABLE );
+    ck_assert_uint_eq(
+      bosl_chunk_read_operand( chunk, index * 18 + 731 ), index );
+  }
+  // block with all local slots
+  ck_assert_int_eq( chunk->code[ 720 ], BOSL_OPCODE_SCOPE_PUSH );
+  ck_assert_uint_eq( bosl_chunk_read_operand( chunk, 721 ), 40 );
+  // globals and locals are found through the index
+  size_t offset = 1445;
+  for ( size_t index = 0; index < count; index++ ) {
+    ck_assert_int_eq( chunk->code[ offset ], BOSL_OPCODE_GET_VARIABLE );
+    ck_assert_uint_eq( bosl_chunk_read_operand( chunk, offset + 1 ), 1 );
+    ck_assert_uint_eq(
+      bosl_chunk_read_operand( chunk, offset + 5 ), read[ index ] );
+    offset += 14;
+    ck_assert_int_eq( chunk->code[ offset ], BOSL_OPCODE_GET_VARIABLE );
+    ck_assert_uint_eq( bosl_chunk_read_operand( chunk, offset + 1 ), 0 );
+    ck_assert_uint_eq(
+      bosl_chunk_read_operand( chunk, offset + 5 ), read[ index ] );
+    offset += 14;
+  }
+  ck_assert_int_eq( chunk->code[ offset ], BOSL_OPCODE_SCOPE_POP );
+}
+END_TEST
+
+static Suite* compiler_suite( void ) {
+  Suite* s;
+  TCase* tc_core;
+
+  s = suite_create( "libbosl" );
+  // test cases
+  tc_core = tcase_create( "compiler" );
+  // add tests
+  tcase_add_checked_fixture( tc_core, setup, teardown );
+  tcase_add_test( tc_core, test_simple_expression );
+  tcase_add_test( tc_core, test_while_break );
+  tcase_add_test( tc_core, test_variable_slot );
+  tcase_add_test( tc_core, test_variable_slot_large_scope );
+  suite_add_tcase( s, tc_core );
+  // return suite
+  return s;
+}
+
+int main( void ) {
+  int number_failed;
+  Suite* s;
+  SRunner* sr;
+
+  s = compiler_suite();
+  sr = srunner_create( s );
+
+  srunner_run_all( sr, CK_NORMAL );
+  number_failed = srunner_ntests_failed( sr );
+  srunner_free( sr );
+  return ( 0 == number_failed ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
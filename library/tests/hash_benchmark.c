@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../lib/collection/hashmap.h"
+
+#define KEY_COUNT 4096
+#define KEY_SIZE 24
+#define ROUNDS 2000
+
+static char keys[ KEY_COUNT ][ KEY_SIZE ];
+static size_t lengths[ KEY_COUNT ];
+
+/**
+ * @brief Jenkin's one_at_a_time as reference
+ *
+ * @param key
+ * @param len
+ * @return
+ */
+static size_t one_at_a_time( const char* key, size_t len ) {
+  const uint8_t* byte = ( const uint8_t* )key;
+  size_t hash = 0;
+  for ( size_t idx = 0; idx < len; idx++ ) {
+    hash += *byte++;
+    hash += ( hash << 10 );
+    hash ^= ( hash >> 6 );
+  }
+  hash += ( hash << 3 );
+  hash ^= ( hash >> 11 );
+  hash += ( hash << 15 );
+  return hash;
+}
+
+/**
+ * @brief Generate identifier shaped keys between 1 and 16 characters
+ */
+static void generate_keys( void ) {
+  const char* charset = "abcdefghijklmnopqrstuvwxyz_0123456789";
+  srand( 42 );
+  for ( size_t i = 0; i < KEY_COUNT; i++ ) {
+    size_t length = 1 + ( size_t )rand() % 16;
+    for ( size_t j = 0; j < length; j++ ) {
+      // first character mustn't be a digit
+      size_t range = j ? 37 : 27;
+      keys[ i ][ j ] = charset[ ( size_t )rand() % range ];
+    }
+    keys[ i ][ length ] = '\0';
+    lengths[ i ] = length;
+  }
+}
+
+/**
+ * @brief Measure hash function over all keys
+ *
+ * @param name
+ * @param hash
+ */
+static void measure(
+  const char* name,
+  size_t ( * hash )( const char*, size_t )
+) {
+  size_t sum = 0;
+  clock_t start = clock();
+  for ( size_t round = 0; round < ROUNDS; round++ ) {
+    for ( size_t i = 0; i < KEY_COUNT; i++ ) {
+      sum += hash( keys[ i ], lengths[ i ] );
+    }
+  }
+  double seconds = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+  double ns = seconds * 1e9 / ( ( double )ROUNDS * KEY_COUNT );
+  printf( "%-16s %8.2f ns/key (checksum %zx)\n", name, ns, sum );
+}
+
+/**
+ * @brief Measure hashmap lookups of all keys
+ */
+static void measure_lookup( void ) {
+  hashmap_table_t* table = hashmap_construct( NULL );
+  if ( !table ) {
+    return;
+  }
+  for ( size_t i = 0; i < KEY_COUNT; i++ ) {
+    hashmap_value_set_n( table, keys[ i ], ( void* )( i + 1 ), lengths[ i ] );
+  }
+  size_t found = 0;
+  clock_t start = clock();
+  for ( size_t round = 0; round < ROUNDS; round++ ) {
+    for ( size_t i = 0; i < KEY_COUNT; i++ ) {
+      found += NULL != hashmap_value_get_n( table, keys[ i ], lengths[ i ] );
+    }
+  }
+  double seconds = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+  double ns = seconds * 1e9 / ( ( double )ROUNDS * KEY_COUNT );
+  printf( "%-16s %8.2f ns/key (found %zu)\n", "hashmap lookup", ns, found );
+  hashmap_destruct( table );
+}
+
+int main( void ) {
+  generate_keys();
+  measure( "one_at_a_time", one_at_a_time );
+  measure( "hashmap_hash", hashmap_hash );
+  measure_lookup();
+  return EXIT_SUCCESS;
+}
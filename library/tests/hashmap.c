@@ -22,6 +22,8 @@
 #include <stdio.h>
 #include "../lib/collection/hashmap.h"
 
+HASHMAP_DEFINE( typed_map, uint32_t )
+
 hashmap_table_t* table;
 
 static void setup( void ) {
@@ -171,6 +173,293 @@ START_TEST( test_hashmap_iterator ) {
 }
 END_TEST
 
+START_TEST( test_hashmap_length_key ) {
+  // add key by length which is not null terminated
+  const char* added_key = hashmap_value_set_n( table, "foobar", ( void* )5, 3 );
+  ck_assert_ptr_nonnull( added_key );
+  ck_assert_str_eq( added_key, "foo" );
+  ck_assert( 1 == hashmap_length( table ) );
+  // get by length and null terminated key
+  ck_assert_ptr_eq( hashmap_value_get_n( table, "food", 3 ), ( void* )5 );
+  ck_assert_ptr_eq( hashmap_value_get( table, "foo" ), ( void* )5 );
+  // prefix and longer key don't match
+  ck_assert_ptr_null( hashmap_value_get_n( table, "foo", 2 ) );
+  ck_assert_ptr_null( hashmap_value_get( table, "food" ) );
+  // delete by length
+  ck_assert( !hashmap_value_del_n( table, "fo", 2 ) );
+  ck_assert( hashmap_value_del_n( table, "foobar", 3 ) );
+  ck_assert_ptr_null( hashmap_value_get( table, "foo" ) );
+}
+END_TEST
+
+START_TEST( test_hashmap_hashed_key ) {
+  size_t hash = hashmap_hash( "foobar", 3 );
+  // add and get with already generated hash
+  const char* added_key = hashmap_value_set_hashed(
+    table, "foobar", ( void* )7, 3, hash );
+  ck_assert_ptr_nonnull( added_key );
+  ck_assert_str_eq( added_key, "foo" );
+  ck_assert_ptr_eq(
+    hashmap_value_get_hashed( table, "food", 3, hash ), ( void* )7 );
+  // entry is found by the variants generating the hash
+  ck_assert_ptr_eq( hashmap_value_get( table, "foo" ), ( void* )7 );
+  ck_assert_ptr_eq(
+    hashmap_value_set_hashed( table, "foo", ( void* )8, 3, hash ), added_key );
+  ck_assert_ptr_eq( hashmap_value_get_n( table, "foo", 3 ), ( void* )8 );
+  ck_assert( 1 == hashmap_length( table ) );
+}
+END_TEST
+
+START_TEST( test_hashmap_delete ) {
+  char key[ 16 ];
+  // add a lot of keys to get collisions
+  for ( size_t i = 1; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+  }
+  ck_assert( 100 == hashmap_length( table ) );
+  // delete every second key
+  for ( size_t i = 1; i <= 100; i += 2 ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert( hashmap_value_del( table, key ) );
+    ck_assert( !hashmap_value_del( table, key ) );
+  }
+  ck_assert( 50 == hashmap_length( table ) );
+  // remaining keys are still found
+  for ( size_t i = 1; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    if ( i % 2 ) {
+      ck_assert_ptr_null( hashmap_value_get( table, key ) );
+    } else {
+      ck_assert_ptr_eq( hashmap_value_get( table, key ), ( void* )i );
+    }
+  }
+}
+END_TEST
+
+START_TEST( test_hashmap_load_factor ) {
+  char key[ 16 ];
+  // invalid load factors are rejected
+  ck_assert( !hashmap_max_load_factor( table, 0 ) );
+  ck_assert( !hashmap_max_load_factor( table, 100 ) );
+  ck_assert( hashmap_max_load_factor( table, 50 ) );
+  // add keys and check bound after each insert
+  for ( size_t i = 1; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+    ck_assert( table->length * 100 <= table->capacity * 50 );
+  }
+}
+END_TEST
+
+START_TEST( test_hashmap_reserve_shrink ) {
+  char key[ 16 ];
+  // reserve space and check it's not resized while adding
+  ck_assert( hashmap_reserve( table, 100 ) );
+  size_t capacity = table->capacity;
+  ck_assert( capacity * HASHMAP_MAX_LOAD_FACTOR >= 100 * 100 );
+  for ( size_t i = 1; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+  }
+  ck_assert( capacity == table->capacity );
+  // delete most and shrink
+  for ( size_t i = 1; i <= 90; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert( hashmap_value_del( table, key ) );
+  }
+  ck_assert( hashmap_shrink( table ) );
+  ck_assert( table->capacity < capacity );
+  // remaining keys are still found
+  for ( size_t i = 91; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_eq( hashmap_value_get( table, key ), ( void* )i );
+  }
+  // shrink of empty map releases entries
+  for ( size_t i = 91; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert( hashmap_value_del( table, key ) );
+  }
+  ck_assert( hashmap_shrink( table ) );
+  ck_assert_ptr_null( table->entries );
+  ck_assert( 0 == table->capacity );
+}
+END_TEST
+
+START_TEST( test_hashmap_hash ) {
+  // same content results in same hash
+  ck_assert_uint_eq( hashmap_hash( "foobar", 3 ), hashmap_hash( "foo", 3 ) );
+  ck_assert_uint_eq(
+    hashmap_hash( "a_long_identifier_name", 22 ),
+    hashmap_hash( "a_long_identifier_name", 22 )
+  );
+  // length is part of hash
+  ck_assert_uint_ne( hashmap_hash( "foo", 3 ), hashmap_hash( "foo", 2 ) );
+  ck_assert_uint_ne( hashmap_hash( "", 0 ), hashmap_hash( "\0", 1 ) );
+  // different content results in different hash
+  ck_assert_uint_ne( hashmap_hash( "int32", 5 ), hashmap_hash( "int64", 5 ) );
+  ck_assert_uint_ne(
+    hashmap_hash( "a_long_identifier_name", 22 ),
+    hashmap_hash( "a_long_identifier_namf", 22 )
+  );
+}
+END_TEST
+
+START_TEST( test_hashmap_incremental ) {
+  char key[ 16 ];
+  bool migrating = false;
+  hashmap_incremental_resize( table, true );
+  // add keys and check all are reachable while migrating
+  for ( size_t i = 1; i <= 200; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+    migrating = migrating || table->old_entries;
+    for ( size_t j = 1; j <= i; j += 7 ) {
+      snprintf( key, sizeof( key ), "key%zu", j );
+      ck_assert_ptr_eq( hashmap_value_get( table, key ), ( void* )j );
+    }
+  }
+#if defined( HASHMAP_COMPACT )
+  // compact layout is always resized at once
+  ck_assert( !migrating );
+#else
+  ck_assert( migrating );
+#endif
+  // delete some, which may still be within previous slots
+  for ( size_t i = 1; i <= 200; i += 3 ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert( hashmap_value_del( table, key ) );
+  }
+  // iterator returns every entry once
+  size_t count = 0;
+  hashmap_iterator_t it = hashmap_iterator( table );
+  while ( hashmap_next( &it ) ) {
+    count++;
+  }
+  ck_assert_uint_eq( count, hashmap_length( table ) );
+  // disabling finishes migration
+  hashmap_incremental_resize( table, false );
+  ck_assert_ptr_null( table->old_entries );
+  for ( size_t i = 1; i <= 200; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    if ( 1 == i % 3 ) {
+      ck_assert_ptr_null( hashmap_value_get( table, key ) );
+    } else {
+      ck_assert_ptr_eq( hashmap_value_get( table, key ), ( void* )i );
+    }
+  }
+}
+END_TEST
+
+START_TEST( test_hashmap_define ) {
+  char key[ 16 ];
+  typed_map_t map;
+  typed_map_init( &map );
+  // add values, zero is a valid one
+  for ( uint32_t i = 0; i < 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%u", i );
+    ck_assert( typed_map_set( &map, key, strlen( key ), i ) );
+  }
+  ck_assert_uint_eq( map.length, 100 );
+  // update one
+  ck_assert( typed_map_set( &map, "key0", 4, 1000 ) );
+  ck_assert_uint_eq( map.length, 100 );
+  ck_assert_uint_eq( *typed_map_get( &map, "key0", 4 ), 1000 );
+  ck_assert_ptr_null( typed_map_get( &map, "key", 3 ) );
+  // delete every second one
+  for ( uint32_t i = 0; i < 100; i += 2 ) {
+    snprintf( key, sizeof( key ), "key%u", i );
+    ck_assert( typed_map_del( &map, key, strlen( key ) ) );
+    ck_assert( !typed_map_del( &map, key, strlen( key ) ) );
+  }
+  ck_assert_uint_eq( map.length, 50 );
+  // remaining ones are still found
+  for ( uint32_t i = 1; i < 100; i += 2 ) {
+    snprintf( key, sizeof( key ), "key%u", i );
+    ck_assert_uint_eq( *typed_map_get( &map, key, strlen( key ) ), i );
+  }
+  // iterate over remaining ones
+  size_t index = 0;
+  size_t count = 0;
+  typed_map_entry_t* entry;
+  while ( ( entry = typed_map_next( &map, &index ) ) ) {
+    ck_assert_uint_eq( entry->value % 2, 1 );
+    count++;
+  }
+  ck_assert_uint_eq( count, 50 );
+  typed_map_free( &map );
+}
+END_TEST
+
+#if defined( HASHMAP_COMPACT )
+START_TEST( test_hashmap_load_factor_populated ) {
+  char key[ 16 ];
+  // populate with default load factor
+  for ( size_t i = 1; i <= 40; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+  }
+  // lower load factor, current capacity may still fit
+  ck_assert( hashmap_max_load_factor( table, 50 ) );
+  ck_assert_uint_eq( table->usable, table->capacity * 50 / 100 );
+  // new limit is kept from now on
+  for ( size_t i = 41; i <= 200; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+    ck_assert( table->used * 100 <= table->capacity * 50 );
+  }
+  // raise load factor again, dense entries are enlarged
+  ck_assert( hashmap_max_load_factor( table, 90 ) );
+  size_t capacity = table->capacity;
+  for ( size_t i = 201; i <= capacity * 90 / 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+  }
+  ck_assert_uint_eq( table->capacity, capacity );
+  // every entry is still there
+  for ( size_t i = 1; i <= hashmap_length( table ); i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_eq( hashmap_value_get( table, key ), ( void* )i );
+  }
+}
+END_TEST
+
+START_TEST( test_hashmap_insertion_order ) {
+  char key[ 16 ];
+  // add keys, enough for a few resizes
+  for ( size_t i = 1; i <= 100; i++ ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert_ptr_nonnull( hashmap_value_set( table, key, ( void* )i ) );
+  }
+  // delete some and add one again
+  for ( size_t i = 1; i <= 100; i += 4 ) {
+    snprintf( key, sizeof( key ), "key%zu", i );
+    ck_assert( hashmap_value_del( table, key ) );
+  }
+  ck_assert_ptr_nonnull( hashmap_value_set( table, "key1", ( void* )101 ) );
+  // iterator returns remaining entries in insertion order
+  size_t previous = 0;
+  size_t count = 0;
+  hashmap_iterator_t it = hashmap_iterator( table );
+  while ( hashmap_next( &it ) ) {
+    count++;
+    // key added again is the last one
+    if ( ( void* )101 == it.value ) {
+      ck_assert_str_eq( it.key, "key1" );
+      ck_assert_uint_eq( count, hashmap_length( table ) );
+      continue;
+    }
+    ck_assert( ( size_t )it.value > previous );
+    previous = ( size_t )it.value;
+  }
+  ck_assert_uint_eq( count, hashmap_length( table ) );
+  // shrink drops holes
+  ck_assert( hashmap_shrink( table ) );
+  ck_assert_uint_eq( table->used, hashmap_length( table ) );
+}
+END_TEST
+#endif
+
 static Suite* hashmap_suite( void ) {
   Suite* s;
   TCase* tc_core;
@@ -187,6 +476,18 @@ static Suite* hashmap_suite( void ) {
   tcase_add_test( tc_core, test_hashmap_get_added );
   tcase_add_test( tc_core, test_hashmap_update );
   tcase_add_test( tc_core, test_hashmap_iterator );
+  tcase_add_test( tc_core, test_hashmap_length_key );
+  tcase_add_test( tc_core, test_hashmap_hashed_key );
+  tcase_add_test( tc_core, test_hashmap_delete );
+  tcase_add_test( tc_core, test_hashmap_load_factor );
+  tcase_add_test( tc_core, test_hashmap_reserve_shrink );
+  tcase_add_test( tc_core, test_hashmap_hash );
+  tcase_add_test( tc_core, test_hashmap_incremental );
+  tcase_add_test( tc_core, test_hashmap_define );
+#if defined( HASHMAP_COMPACT )
+  tcase_add_test( tc_core, test_hashmap_load_factor_populated );
+  tcase_add_test( tc_core, test_hashmap_insertion_order );
+#endif
   suite_add_tcase( s, tc_core );
   // return suite
   return s;
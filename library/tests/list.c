@@ -102,7 +102,7 @@ START_TEST( test_item_create ) {
   ck_assert_ptr_null( item->next );
   ck_assert_ptr_null( item->previous );
   ck_assert_ptr_eq( item->data, data );
-  free( item );
+  list_default_cleanup( item );
 }
 END_TEST
 
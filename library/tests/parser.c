@@ -29,29 +29,26 @@ static void setup( void ) {
 }
 
 static void teardown( void ) {
-  // destroy scanner and parser
+  // destroy scanner, parser and interned names
   bosl_scanner_free();
   bosl_parser_free();
+  bosl_atom_free();
 }
 
 START_TEST( test_simple_expression ) {
   const char expression[] = "3 + 2 * 7;";
   // init scanner
   ck_assert( bosl_scanner_init( expression ) );
-  // parse token
-  list_manager_t* token = bosl_scanner_scan();
-  ck_assert_ptr_nonnull( token );
-  // init parser
-  ck_assert( bosl_parser_init( token ) );
+  // init parser pulling token from scanner
+  ck_assert( bosl_parser_init() );
   // parse ast
-  list_manager_t* ast = bosl_parser_scan();
+  vector_t* ast = bosl_parser_scan();
   ck_assert_ptr_nonnull( ast );
   // check tokens
-  list_item_t* current = ast->first;
   bosl_ast_node_t* n;
   // token should be expression statement ( + 3 ( * 2 7 ) )
   // get node
-  n = current->data;
+  n = vector_at( ast, 0 );
   ck_assert_ptr_nonnull( n->statement );
   // check statement and expression
   ck_assert( n->statement->type == STATEMENT_EXPRESSION );
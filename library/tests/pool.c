@@ -0,0 +1,151 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <check.h>
+#include "../lib/collection/pool.h"
+
+pool_t* pool;
+
+static void setup( void ) {
+  pool = pool_construct( 24 );
+  ck_assert_ptr_nonnull( pool );
+}
+
+static void teardown( void ) {
+  pool_destruct( pool );
+  pool = NULL;
+}
+
+START_TEST( test_pool_create ) {
+  ck_assert_uint_eq( pool->size % POOL_ALIGNMENT, 0 );
+  ck_assert_uint_ge( pool->size, 24 );
+  ck_assert_uint_gt( pool->slab_item, 0 );
+  ck_assert_ptr_null( pool->slab );
+  ck_assert_ptr_null( pool->free );
+  ck_assert_uint_eq( pool->hit, 0 );
+  ck_assert_uint_eq( pool->miss, 0 );
+}
+END_TEST
+
+START_TEST( test_pool_allocate ) {
+  // first allocation needs a slab
+  uint8_t* a = pool_item_allocate( pool );
+  ck_assert_ptr_nonnull( a );
+  ck_assert_uint_eq( pool->miss, 1 );
+  ck_assert_uint_eq( pool->hit, 0 );
+  // second allocation is bumped from same slab
+  uint8_t* b = pool_item_allocate( pool );
+  ck_assert_ptr_nonnull( b );
+  ck_assert_ptr_eq( b, a + pool->size );
+  ck_assert_uint_eq( pool->miss, 1 );
+  ck_assert_uint_eq( pool->hit, 1 );
+  // alignment
+  ck_assert_uint_eq( ( uintptr_t )a % POOL_ALIGNMENT, 0 );
+  ck_assert_uint_eq( ( uintptr_t )b % POOL_ALIGNMENT, 0 );
+}
+END_TEST
+
+START_TEST( test_pool_reuse ) {
+  void* a = pool_item_allocate( pool );
+  ck_assert_ptr_nonnull( a );
+  // release and allocate again
+  pool_item_free( pool, a );
+  ck_assert_ptr_eq( pool->free, a );
+  void* b = pool_item_allocate( pool );
+  ck_assert_ptr_eq( b, a );
+  ck_assert_ptr_null( pool->free );
+  ck_assert_uint_eq( pool->hit, 1 );
+}
+END_TEST
+
+START_TEST( test_pool_slab_exhausted ) {
+  // use up whole first slab
+  for ( size_t index = 0; index < pool->slab_item; index++ ) {
+    ck_assert_ptr_nonnull( pool_item_allocate( pool ) );
+  }
+  ck_assert_uint_eq( pool->miss, 1 );
+  // next allocation needs another slab
+  ck_assert_ptr_nonnull( pool_item_allocate( pool ) );
+  ck_assert_uint_eq( pool->miss, 2 );
+  ck_assert_ptr_nonnull( pool->slab->next );
+  // clear releases everything
+  pool_clear( pool );
+  ck_assert_ptr_null( pool->slab );
+  ck_assert_ptr_null( pool->free );
+}
+END_TEST
+
+START_TEST( test_pool_size_class ) {
+  // invalid and large sizes are not served by size classes
+  ck_assert_ptr_null( pool_size_class( 0 ) );
+  ck_assert_ptr_null( pool_size_class( POOL_SIZE_CLASS_MAX + 1 ) );
+  // sizes within one class share pool
+  pool_t* small = pool_size_class( 1 );
+  ck_assert_ptr_nonnull( small );
+  ck_assert_ptr_eq( small, pool_size_class( POOL_SIZE_CLASS_STEP ) );
+  ck_assert_ptr_ne( small, pool_size_class( POOL_SIZE_CLASS_STEP + 1 ) );
+  ck_assert_uint_ge( small->size, POOL_SIZE_CLASS_STEP );
+  // allocate and free via size class
+  void* a = pool_allocate( 10 );
+  ck_assert_ptr_nonnull( a );
+  pool_free( a, 10 );
+  ck_assert_ptr_eq( small->free, a );
+  ck_assert_ptr_eq( pool_allocate( 12 ), a );
+  pool_free( a, 12 );
+  // large allocation falls back to heap
+  void* large = pool_allocate( POOL_SIZE_CLASS_MAX + 1 );
+  ck_assert_ptr_nonnull( large );
+  pool_free( large, POOL_SIZE_CLASS_MAX + 1 );
+}
+END_TEST
+
+static Suite* pool_suite( void ) {
+  Suite* s;
+  TCase* tc_core;
+
+  s = suite_create( "libbosl" );
+  // test cases
+  tc_core = tcase_create( "pool" );
+  // add tests
+  tcase_add_checked_fixture( tc_core, setup, teardown );
+  tcase_add_test( tc_core, test_pool_create );
+  tcase_add_test( tc_core, test_pool_allocate );
+  tcase_add_test( tc_core, test_pool_reuse );
+  tcase_add_test( tc_core, test_pool_slab_exhausted );
+  tcase_add_test( tc_core, test_pool_size_class );
+  suite_add_tcase( s, tc_core );
+  // return suite
+  return s;
+}
+
+int main( void ) {
+  int number_failed;
+  Suite* s;
+  SRunner* sr;
+
+  s = pool_suite();
+  sr = srunner_create( s );
+
+  srunner_run_all( sr, CK_NORMAL );
+  number_failed = srunner_ntests_failed( sr );
+  srunner_free( sr );
+  return ( 0 == number_failed ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
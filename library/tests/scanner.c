@@ -18,6 +18,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <check.h>
 #include "../lib/scanner.h"
 
@@ -26,6 +27,7 @@ static void setup( void ) {
 
 static void teardown( void ) {
   bosl_scanner_free();
+  bosl_atom_free();
 }
 
 START_TEST( test_scanner_init ) {
@@ -37,19 +39,19 @@ START_TEST( test_scanner_scan_string_single_line ) {
   char str[] = "\"some string\"";
   char* cmp = &str[ 1 ];
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_STRING );
   ck_assert( 11 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 12;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -62,19 +64,19 @@ START_TEST( test_scanner_scan_string_multi_line ) {
 string\"";
   char* cmp = &str[ 1 ];
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_STRING );
   ck_assert( 11 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 2 );
 
   cmp += 12;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -87,19 +89,19 @@ START_TEST( test_scanner_scan_string_invalid ) {
   char* cmp = str;
   char error_cmp[] = "Unterminated string found";
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_ERROR );
   ck_assert( 25 == token->length );
   ck_assert_str_eq( token->start, error_cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 12;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -111,19 +113,19 @@ START_TEST( test_scanner_scan_int ) {
   char str[] = "1337";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -135,19 +137,19 @@ START_TEST( test_scanner_scan_float ) {
   char str[] = "13.37";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -159,19 +161,19 @@ START_TEST( test_scanner_scan_hex_lower ) {
   char str[] = "0x123abc";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 8 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 8;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -183,19 +185,19 @@ START_TEST( test_scanner_scan_hex_upper ) {
   char str[] = "0X123ABC";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 8 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 8;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -207,19 +209,19 @@ START_TEST( test_scanner_scan_hex_mixed_lower_x ) {
   char str[] = "0x123AbC";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 8 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 8;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -231,19 +233,19 @@ START_TEST( test_scanner_scan_hex_mixed_upper_x ) {
   char str[] = "0X123AbC";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NUMBER );
   ck_assert( 8 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 8;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -255,19 +257,19 @@ START_TEST( test_scanner_scan_literal_keyword_within ) {
   char str[] = "else_abc";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_IDENTIFIER );
   ck_assert( 8 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 8;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -279,19 +281,19 @@ START_TEST( test_scanner_scan_literal_no_keyword_within ) {
   char str[] = "isaac_newton";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_IDENTIFIER );
   ck_assert( 12 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 12;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -303,19 +305,19 @@ START_TEST( test_scanner_scan_keyword_let ) {
   char str[] = "let";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LET );
   ck_assert( 3 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 3;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -327,19 +329,19 @@ START_TEST( test_scanner_scan_keyword_const ) {
   char str[] = "const";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_CONST );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -351,19 +353,19 @@ START_TEST( test_scanner_scan_keyword_pointer ) {
   char str[] = "pointer";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_POINTER );
   ck_assert( 7 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 7;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -375,19 +377,19 @@ START_TEST( test_scanner_scan_keyword_true ) {
   char str[] = "true";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TRUE );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -399,19 +401,19 @@ START_TEST( test_scanner_scan_keyword_false ) {
   char str[] = "false";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_FALSE );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -423,19 +425,19 @@ START_TEST( test_scanner_scan_keyword_null ) {
   char str[] = "null";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_NULL );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -447,19 +449,19 @@ START_TEST( test_scanner_scan_keyword_if ) {
   char str[] = "if";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_IF );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -471,19 +473,19 @@ START_TEST( test_scanner_scan_keyword_else ) {
   char str[] = "else";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_ELSE );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -495,19 +497,19 @@ START_TEST( test_scanner_scan_keyword_while ) {
   char str[] = "while";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_WHILE );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -519,19 +521,19 @@ START_TEST( test_scanner_scan_keyword_function ) {
   char str[] = "fn";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_FUNCTION );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -543,19 +545,19 @@ START_TEST( test_scanner_scan_keyword_return ) {
   char str[] = "return";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_RETURN );
   ck_assert( 6 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 6;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -567,19 +569,19 @@ START_TEST( test_scanner_load ) {
   char str[] = "load";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LOAD );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -591,19 +593,19 @@ START_TEST( test_scanner_scan_builtin_print ) {
   char str[] = "print";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_PRINT );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -615,12 +617,12 @@ START_TEST( test_scanner_scan_comment_skip ) {
   char str[] = "// some comment to skip";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
   cmp += 23;
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -632,19 +634,19 @@ START_TEST( test_scanner_scan_type_int8 ) {
   char str[] = "int8";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -656,19 +658,19 @@ START_TEST( test_scanner_scan_type_int16 ) {
   char str[] = "int16";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -680,19 +682,19 @@ START_TEST( test_scanner_scan_type_int32 ) {
   char str[] = "int32";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -704,19 +706,19 @@ START_TEST( test_scanner_scan_type_int64 ) {
   char str[] = "int64";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -728,19 +730,19 @@ START_TEST( test_scanner_scan_type_uint8 ) {
   char str[] = "uint8";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -752,19 +754,19 @@ START_TEST( test_scanner_scan_type_uint16 ) {
   char str[] = "uint16";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 6 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 6;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -776,19 +778,19 @@ START_TEST( test_scanner_scan_type_uint32 ) {
   char str[] = "uint32";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 6 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 6;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -800,19 +802,19 @@ START_TEST( test_scanner_scan_type_uint64 ) {
   char str[] = "uint64";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 6 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 6;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -824,19 +826,19 @@ START_TEST( test_scanner_scan_type_float ) {
   char str[] = "float";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 5 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 5;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -848,19 +850,19 @@ START_TEST( test_scanner_scan_type_string ) {
   char str[] = "string";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 6 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 6;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -872,19 +874,19 @@ START_TEST( test_scanner_scan_type_void ) {
   char str[] = "void";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -896,19 +898,19 @@ START_TEST( test_scanner_scan_type_bool ) {
   char str[] = "bool";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_TYPE_IDENTIFIER );
   ck_assert( 4 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 4;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -920,19 +922,19 @@ START_TEST( test_scanner_scan_left_parenthesis ) {
   char str[] = "(";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LEFT_PARENTHESIS );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -944,19 +946,19 @@ START_TEST( test_scanner_scan_right_parenthesis ) {
   char str[] = ")";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_RIGHT_PARENTHESIS );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -968,19 +970,19 @@ START_TEST( test_scanner_scan_left_brace ) {
   char str[] = "{";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LEFT_BRACE );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -992,19 +994,19 @@ START_TEST( test_scanner_scan_right_brace ) {
   char str[] = "}";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_RIGHT_BRACE );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1016,19 +1018,19 @@ START_TEST( test_scanner_scan_comma ) {
   char str[] = ",";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_COMMA );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1040,19 +1042,19 @@ START_TEST( test_scanner_scan_colon ) {
   char str[] = ":";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_COLON );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1064,19 +1066,19 @@ START_TEST( test_scanner_scan_semicolon ) {
   char str[] = ";";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_SEMICOLON );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1088,19 +1090,19 @@ START_TEST( test_scanner_scan_minus ) {
   char str[] = "-";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_MINUS );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1112,19 +1114,19 @@ START_TEST( test_scanner_scan_plus ) {
   char str[] = "+";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_PLUS );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1136,19 +1138,19 @@ START_TEST( test_scanner_scan_star ) {
   char str[] = "*";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_STAR );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1160,19 +1162,19 @@ START_TEST( test_scanner_scan_modulo ) {
   char str[] = "%";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_MODULO );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1184,19 +1186,19 @@ START_TEST( test_scanner_scan_slash ) {
   char str[] = "/";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_SLASH );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1208,19 +1210,19 @@ START_TEST( test_scanner_scan_xor ) {
   char str[] = "^";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_XOR );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1232,19 +1234,19 @@ START_TEST( test_scanner_scan_binary_one_complement ) {
   char str[] = "~";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_BINARY_ONE_COMPLEMENT );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1256,19 +1258,19 @@ START_TEST( test_scanner_scan_shift_left ) {
   char str[] = "<<";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_SHIFT_LEFT );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1280,19 +1282,19 @@ START_TEST( test_scanner_scan_shift_right ) {
   char str[] = ">>";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_SHIFT_RIGHT );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1304,19 +1306,19 @@ START_TEST( test_scanner_scan_bang ) {
   char str[] = "!";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_BANG );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1328,19 +1330,19 @@ START_TEST( test_scanner_scan_bang_equal ) {
   char str[] = "!=";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_BANG_EQUAL );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1352,19 +1354,19 @@ START_TEST( test_scanner_scan_equal ) {
   char str[] = "=";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EQUAL );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1376,19 +1378,19 @@ START_TEST( test_scanner_scan_equal_equal ) {
   char str[] = "==";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EQUAL_EQUAL );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1400,19 +1402,19 @@ START_TEST( test_scanner_scan_greater ) {
   char str[] = ">";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_GREATER );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1424,19 +1426,19 @@ START_TEST( test_scanner_scan_greater_equal ) {
   char str[] = ">=";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_GREATER_EQUAL );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1448,19 +1450,19 @@ START_TEST( test_scanner_scan_less ) {
   char str[] = "<";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LESS );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1472,19 +1474,19 @@ START_TEST( test_scanner_scan_less_equal ) {
   char str[] = "<=";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LESS_EQUAL );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1496,19 +1498,19 @@ START_TEST( test_scanner_scan_and ) {
   char str[] = "&";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_AND );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1520,19 +1522,19 @@ START_TEST( test_scanner_scan_and_and ) {
   char str[] = "&&";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_AND_AND );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1544,19 +1546,19 @@ START_TEST( test_scanner_scan_or ) {
   char str[] = "|";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_OR );
   ck_assert( 1 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1568,19 +1570,19 @@ START_TEST( test_scanner_scan_or_or ) {
   char str[] = "||";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_OR_OR );
   ck_assert( 2 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 2;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1593,19 +1595,19 @@ START_TEST( test_scanner_scan_invalid_character ) {
   char* cmp = str;
   char error_cmp[] = "Unknown token";
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_ERROR );
   ck_assert( 13 == token->length );
   ck_assert_str_eq( token->start, error_cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 1;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1618,20 +1620,20 @@ START_TEST( test_scanner_scan_with_newline ) {
 let";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
   cmp += 1;
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LET );
   ck_assert( 3 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 2 );
 
   cmp += 3;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1643,20 +1645,20 @@ START_TEST( test_scanner_scan_white_space_skip_space ) {
   char str[] = " let";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
   cmp += 1;
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LET );
   ck_assert( 3 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 3;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1668,20 +1670,20 @@ START_TEST( test_scanner_scan_white_space_skip_tab ) {
   char str[] = "\tlet";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
   cmp += 1;
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LET );
   ck_assert( 3 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 3;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1693,20 +1695,20 @@ START_TEST( test_scanner_scan_white_space_skip_carriage_return ) {
   char str[] = "\rlet";
   char* cmp = str;
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
   cmp += 1;
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LET );
   ck_assert( 3 == token->length );
   ck_assert_str_eq( token->start, cmp );
   ck_assert_int_eq( token->line, 1 );
 
   cmp += 3;
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
   ck_assert_str_eq( token->start, cmp );
@@ -1717,41 +1719,306 @@ END_TEST
 START_TEST( test_scanner_scan_builtin_print_string ) {
   char str[] = "print( \"hello world\" );";
   ck_assert( bosl_scanner_init( str ) );
-  list_manager_t* list = bosl_scanner_scan();
+  vector_t* list = bosl_scanner_scan();
   ck_assert_ptr_nonnull( list );
 
-  list_item_t* current = list->first;
-  bosl_token_t* token = current->data;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_PRINT );
   ck_assert( 5 == token->length );
 
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_LEFT_PARENTHESIS );
   ck_assert( 1 == token->length );
 
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_STRING );
   ck_assert( 11 == token->length );
 
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_RIGHT_PARENTHESIS );
   ck_assert( 1 == token->length );
 
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_SEMICOLON );
   ck_assert( 1 == token->length );
 
-  current = current->next;
-  token = current->data;
+  current++;
+  token = vector_at( list, current );
   ck_assert_int_eq( token->type, TOKEN_EOF );
   ck_assert( 0 == token->length );
 }
 END_TEST
 
+START_TEST( test_scanner_scan_keyword_like_identifier ) {
+  char str[] = "iff fn_ lets int1 int65 uint8x floaT strings continues";
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+
+  size_t current = 0;
+  bosl_token_t* token;
+  for ( ; current < 9; current++ ) {
+    token = vector_at( list, current );
+    ck_assert_int_eq( token->type, TOKEN_IDENTIFIER );
+  }
+
+  token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+  ck_assert( 0 == token->length );
+}
+END_TEST
+
+START_TEST( test_scanner_scan_number_value ) {
+  char str[] = "42 0x1F 2.5 1.5e3";
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+
+  bosl_token_t* token = vector_at( list, 0 );
+  ck_assert_int_eq( token->type, TOKEN_NUMBER );
+  ck_assert_int_eq( token->number_type, TOKEN_NUMBER_TYPE_INT );
+  ck_assert_uint_eq( token->unsigned_number, 42 );
+
+  token = vector_at( list, 1 );
+  ck_assert_int_eq( token->type, TOKEN_NUMBER );
+  ck_assert_int_eq( token->number_type, TOKEN_NUMBER_TYPE_INT );
+  ck_assert_uint_eq( token->unsigned_number, 0x1F );
+
+  token = vector_at( list, 2 );
+  ck_assert_int_eq( token->type, TOKEN_NUMBER );
+  ck_assert_int_eq( token->number_type, TOKEN_NUMBER_TYPE_FLOAT );
+  ck_assert( 2.5L == token->float_number );
+
+  // exponent isn't part of the token, so decoding is incomplete
+  token = vector_at( list, 3 );
+  ck_assert_int_eq( token->type, TOKEN_NUMBER );
+  ck_assert_int_eq( token->number_type, TOKEN_NUMBER_TYPE_INVALID );
+}
+END_TEST
+
+START_TEST( test_scanner_next_token ) {
+  char str[] = "let a = b;";
+  ck_assert( bosl_scanner_init( str ) );
+
+  bosl_token_t* token = bosl_scanner_peek_token( 0 );
+  ck_assert_ptr_nonnull( token );
+  ck_assert_int_eq( token->type, TOKEN_LET );
+  token = bosl_scanner_peek_token( 2 );
+  ck_assert_ptr_nonnull( token );
+  ck_assert_int_eq( token->type, TOKEN_EQUAL );
+  ck_assert_ptr_null( bosl_scanner_peek_token( BOSL_SCANNER_LOOKAHEAD - 1 ) );
+
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_LET );
+  bosl_token_t* retained = bosl_scanner_retain_token( bosl_scanner_next_token() );
+  ck_assert_ptr_nonnull( retained );
+  ck_assert_int_eq( retained->type, TOKEN_IDENTIFIER );
+  ck_assert( 1 == retained->length );
+  ck_assert( 'a' == retained->start[ 0 ] );
+
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_EQUAL );
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_IDENTIFIER );
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_SEMICOLON );
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+  token = bosl_scanner_next_token();
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+
+  // retained token is not affected by following ones
+  ck_assert_int_eq( retained->type, TOKEN_IDENTIFIER );
+  ck_assert( 'a' == retained->start[ 0 ] );
+}
+END_TEST
+
+START_TEST( test_scanner_scan_white_space_skip_block ) {
+  // whitespace run longer than a block with line breaks in different blocks
+  char str[ 64 ];
+  memset( str, ' ', 40 );
+  str[ 3 ] = '\n';
+  str[ 14 ] = '\t';
+  str[ 17 ] = '\n';
+  str[ 30 ] = '\r';
+  str[ 33 ] = '\n';
+  memcpy( str + 40, "let", 4 );
+  char* cmp = str;
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+
+  cmp += 40;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_LET );
+  ck_assert( 3 == token->length );
+  ck_assert_ptr_eq( token->start, cmp );
+  ck_assert_int_eq( token->line, 4 );
+
+  cmp += 3;
+  current++;
+  token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+  ck_assert_ptr_eq( token->start, cmp );
+  ck_assert_int_eq( token->line, 4 );
+}
+END_TEST
+
+START_TEST( test_scanner_scan_comment_skip_block ) {
+  char str[] = "// 0123456789012345678901234567890123456789\nlet";
+  char* cmp = str;
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+
+  cmp += 44;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_LET );
+  ck_assert( 3 == token->length );
+  ck_assert_ptr_eq( token->start, cmp );
+  ck_assert_int_eq( token->line, 2 );
+}
+END_TEST
+
+START_TEST( test_scanner_scan_string_skip_block ) {
+  // line breaks on both sides of 16 and 32 byte boundaries of the body
+  char str[ 64 ];
+  memset( str, 'a', 45 );
+  str[ 0 ] = '"';
+  str[ 15 ] = '\n';
+  str[ 18 ] = '\n';
+  str[ 32 ] = '\n';
+  str[ 35 ] = '\n';
+  memcpy( str + 45, "\" let", 6 );
+  char* cmp = str;
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+
+  cmp += 1;
+  size_t current = 0;
+  bosl_token_t* token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_STRING );
+  ck_assert( 44 == token->length );
+  ck_assert_ptr_eq( token->start, cmp );
+  ck_assert_int_eq( token->line, 5 );
+
+  cmp += 46;
+  current++;
+  token = vector_at( list, current );
+  ck_assert_int_eq( token->type, TOKEN_LET );
+  ck_assert( 3 == token->length );
+  ck_assert_ptr_eq( token->start, cmp );
+  ck_assert_int_eq( token->line, 5 );
+}
+END_TEST
+
+START_TEST( test_scanner_scan_skip_block_boundary ) {
+  // stop characters right in front of and at block boundaries
+  static const size_t offset[] = { 15, 16, 31, 32 };
+  size_t count = sizeof( offset ) / sizeof( offset[ 0 ] );
+  char str[ 512 ];
+  const char* cmp[ 3 * 4 ];
+  size_t length = 0;
+  // whitespace starting with a line break in front of identifier
+  for ( size_t index = 0; index < count; index++ ) {
+    str[ length ] = '\n';
+    memset( str + length + 1, ' ', offset[ index ] - 1 );
+    length += offset[ index ];
+    cmp[ index ] = str + length;
+    str[ length++ ] = 'x';
+  }
+  // string body starting with a line break in front of closing quote
+  for ( size_t index = 0; index < count; index++ ) {
+    str[ length++ ] = '"';
+    cmp[ count + index ] = str + length;
+    str[ length ] = '\n';
+    memset( str + length + 1, 's', offset[ index ] - 1 );
+    length += offset[ index ];
+    str[ length++ ] = '"';
+  }
+  // comment body in front of line break followed by identifier
+  for ( size_t index = 0; index < count; index++ ) {
+    memcpy( str + length, "//", 2 );
+    length += 2;
+    memset( str + length, 'c', offset[ index ] );
+    length += offset[ index ];
+    str[ length++ ] = '\n';
+    cmp[ 2 * count + index ] = str + length;
+    str[ length++ ] = 'x';
+  }
+  // padding so that every stop character is within a whole block
+  memset( str + length, ' ', 32 );
+  length += 32;
+  str[ length ] = '\0';
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+  ck_assert_uint_eq( vector_size( list ), 3 * count + 1 );
+
+  for ( size_t index = 0; index < 3 * count; index++ ) {
+    bosl_token_t* token = vector_at( list, index );
+    ck_assert_int_eq(
+      token->type, index / count == 1 ? TOKEN_STRING : TOKEN_IDENTIFIER );
+    ck_assert( ( index / count == 1 ? offset[ index % count ] : 1 )
+      == token->length );
+    ck_assert_ptr_eq( token->start, cmp[ index ] );
+    ck_assert_uint_eq( token->line, index + 2 );
+  }
+  bosl_token_t* token = vector_at( list, 3 * count );
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+  ck_assert_uint_eq( token->line, 3 * count + 1 );
+}
+END_TEST
+
+#if defined( SCANNER_PARALLEL )
+START_TEST( test_scanner_scan_parallel ) {
+  // strings spanning lines so that some chunk splits land within them
+  const char unit[] = "let a = \"x\ny\"; // \" c\n";
+  size_t unit_length = sizeof( unit ) - 1;
+  size_t count = BOSL_SCANNER_PARALLEL_THRESHOLD / unit_length + 1;
+  char* str = malloc( unit_length * count + 1 );
+  ck_assert_ptr_nonnull( str );
+  for ( size_t index = 0; index < count; index++ ) {
+    memcpy( str + index * unit_length, unit, unit_length );
+  }
+  str[ unit_length * count ] = '\0';
+  ck_assert( bosl_scanner_init( str ) );
+  vector_t* list = bosl_scanner_scan();
+  ck_assert_ptr_nonnull( list );
+  ck_assert_uint_eq( vector_size( list ), count * 5 + 1 );
+
+  bosl_token_t* token;
+  for ( size_t index = 0; index < count; index++ ) {
+    token = vector_at( list, index * 5 );
+    ck_assert_int_eq( token->type, TOKEN_LET );
+    ck_assert_uint_eq( token->line, index * 2 + 1 );
+    token = vector_at( list, index * 5 + 1 );
+    ck_assert_int_eq( token->type, TOKEN_IDENTIFIER );
+    ck_assert_uint_ne( token->atom, BOSL_ATOM_NONE );
+    token = vector_at( list, index * 5 + 3 );
+    ck_assert_int_eq( token->type, TOKEN_STRING );
+    ck_assert( 3 == token->length );
+    ck_assert_uint_eq( token->line, index * 2 + 2 );
+    token = vector_at( list, index * 5 + 4 );
+    ck_assert_int_eq( token->type, TOKEN_SEMICOLON );
+  }
+
+  token = vector_at( list, count * 5 );
+  ck_assert_int_eq( token->type, TOKEN_EOF );
+  ck_assert_uint_eq( token->line, count * 2 + 1 );
+  free( str );
+}
+END_TEST
+#endif
+
 static Suite* scanner_suite( void ) {
   Suite* s;
   TCase* tc_core;
@@ -1834,6 +2101,7 @@ static Suite* scanner_suite( void ) {
   // built-in functions
   tcase_add_test( tc_core, test_scanner_scan_builtin_print );
   tcase_add_test( tc_core, test_scanner_scan_builtin_print_string );
+  tcase_add_test( tc_core, test_scanner_scan_keyword_like_identifier );
   // whitespace ignore
   tcase_add_test( tc_core, test_scanner_scan_white_space_skip_space );
   tcase_add_test( tc_core, test_scanner_scan_white_space_skip_tab );
@@ -1842,6 +2110,16 @@ static Suite* scanner_suite( void ) {
   tcase_add_test( tc_core, test_scanner_scan_comment_skip );
   tcase_add_test( tc_core, test_scanner_scan_invalid_character );
   tcase_add_test( tc_core, test_scanner_scan_with_newline );
+  tcase_add_test( tc_core, test_scanner_scan_number_value );
+  tcase_add_test( tc_core, test_scanner_next_token );
+  // blockwise skipping
+  tcase_add_test( tc_core, test_scanner_scan_white_space_skip_block );
+  tcase_add_test( tc_core, test_scanner_scan_comment_skip_block );
+  tcase_add_test( tc_core, test_scanner_scan_string_skip_block );
+  tcase_add_test( tc_core, test_scanner_scan_skip_block_boundary );
+#if defined( SCANNER_PARALLEL )
+  tcase_add_test( tc_core, test_scanner_scan_parallel );
+#endif
   suite_add_tcase( s, tc_core );
   // return suite
   return s;
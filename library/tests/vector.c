@@ -0,0 +1,184 @@
+/**
+ * Copyright (C) 2022 bolthur project.
+ *
+ * This file is part of bolthur/bosl.
+ *
+ * bolthur/bosl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bolthur/bosl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bolthur/bosl.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <check.h>
+#include "../lib/collection/vector.h"
+
+VECTOR_DEFINE( typed_vector, uint64_t )
+
+vector_t* vector;
+size_t cleanup_count;
+
+static void count_cleanup( __unused void* data ) {
+  cleanup_count++;
+}
+
+static void setup( void ) {
+  vector = vector_construct( NULL );
+  ck_assert_ptr_nonnull( vector );
+  cleanup_count = 0;
+}
+
+static void teardown( void ) {
+  vector_destruct( vector );
+  vector = NULL;
+}
+
+START_TEST( test_vector_construct ) {
+  ck_assert( vector_empty( vector ) );
+  ck_assert_uint_eq( vector_size( vector ), 0 );
+  ck_assert_uint_eq( vector->capacity, VECTOR_INLINE_CAPACITY );
+  ck_assert_ptr_eq( vector->data, vector->inline_data );
+  ck_assert_ptr_null( vector_back( vector ) );
+  ck_assert_ptr_null( vector_pop_back( vector ) );
+}
+END_TEST
+
+START_TEST( test_vector_push_back ) {
+  // fill inline storage
+  for ( size_t index = 1; index <= VECTOR_INLINE_CAPACITY; index++ ) {
+    ck_assert( vector_push_back( vector, ( void* )index ) );
+  }
+  ck_assert_ptr_eq( vector->data, vector->inline_data );
+  // push one more to move to heap storage
+  ck_assert( vector_push_back( vector, ( void* )100 ) );
+  ck_assert_ptr_ne( vector->data, vector->inline_data );
+  ck_assert_uint_eq( vector_size( vector ), VECTOR_INLINE_CAPACITY + 1 );
+  // ensure order is kept
+  for ( size_t index = 0; index < VECTOR_INLINE_CAPACITY; index++ ) {
+    ck_assert_ptr_eq( vector_at( vector, index ), ( void* )( index + 1 ) );
+  }
+  ck_assert_ptr_eq( vector_back( vector ), ( void* )100 );
+  ck_assert_ptr_null( vector_at( vector, VECTOR_INLINE_CAPACITY + 1 ) );
+}
+END_TEST
+
+START_TEST( test_vector_pop_back ) {
+  for ( size_t index = 1; index <= 100; index++ ) {
+    ck_assert( vector_push_back( vector, ( void* )index ) );
+  }
+  for ( size_t index = 100; index > 0; index-- ) {
+    ck_assert_ptr_eq( vector_pop_back( vector ), ( void* )index );
+  }
+  ck_assert( vector_empty( vector ) );
+  ck_assert_ptr_null( vector_pop_back( vector ) );
+}
+END_TEST
+
+START_TEST( test_vector_reserve ) {
+  ck_assert( vector_push_back( vector, ( void* )1 ) );
+  ck_assert( vector_reserve( vector, 64 ) );
+  ck_assert_uint_eq( vector->capacity, 64 );
+  ck_assert_ptr_eq( vector_at( vector, 0 ), ( void* )1 );
+  // smaller reserve doesn't shrink
+  ck_assert( vector_reserve( vector, 2 ) );
+  ck_assert_uint_eq( vector->capacity, 64 );
+}
+END_TEST
+
+START_TEST( test_vector_cleanup ) {
+  vector_t* v = vector_construct( count_cleanup );
+  ck_assert_ptr_nonnull( v );
+  for ( size_t index = 1; index <= 10; index++ ) {
+    ck_assert( vector_push_back( v, ( void* )index ) );
+  }
+  vector_destruct( v );
+  ck_assert_uint_eq( cleanup_count, 10 );
+}
+END_TEST
+
+START_TEST( test_vector_construct_arena ) {
+  arena_t* arena = arena_construct();
+  ck_assert_ptr_nonnull( arena );
+  vector_t* v = vector_construct_arena( arena );
+  ck_assert_ptr_nonnull( v );
+  ck_assert_ptr_eq( v->arena, arena );
+  ck_assert_ptr_eq( v->data, v->inline_data );
+  // push beyond inline storage
+  for ( size_t index = 1; index <= 100; index++ ) {
+    ck_assert( vector_push_back( v, ( void* )index ) );
+  }
+  ck_assert_ptr_ne( v->data, v->inline_data );
+  ck_assert_uint_eq( vector_size( v ), 100 );
+  for ( size_t index = 0; index < 100; index++ ) {
+    ck_assert_ptr_eq( vector_at( v, index ), ( void* )( index + 1 ) );
+  }
+  // vector and storage are released with the arena
+  arena_destruct( arena );
+}
+END_TEST
+
+START_TEST( test_vector_define ) {
+  typed_vector_t v;
+  typed_vector_init( &v );
+  ck_assert_ptr_eq( v.data, v.inline_data );
+  ck_assert_ptr_null( typed_vector_at( &v, 0 ) );
+  // push beyond inline storage
+  for ( uint64_t index = 0; index < 100; index++ ) {
+    ck_assert( typed_vector_push_back( &v, index * 3 ) );
+  }
+  ck_assert_ptr_ne( v.data, v.inline_data );
+  ck_assert_uint_eq( typed_vector_size( &v ), 100 );
+  for ( size_t index = 0; index < 100; index++ ) {
+    ck_assert_uint_eq( *typed_vector_at( &v, index ), index * 3 );
+  }
+  ck_assert_ptr_null( typed_vector_at( &v, 100 ) );
+  // free resets to inline storage
+  typed_vector_free( &v );
+  ck_assert_ptr_eq( v.data, v.inline_data );
+  ck_assert_uint_eq( typed_vector_size( &v ), 0 );
+}
+END_TEST
+
+static Suite* vector_suite( void ) {
+  Suite* s;
+  TCase* tc_core;
+
+  s = suite_create( "libbosl" );
+  // test cases
+  tc_core = tcase_create( "vector" );
+  // add tests
+  tcase_add_checked_fixture( tc_core, setup, teardown );
+  tcase_add_test( tc_core, test_vector_construct );
+  tcase_add_test( tc_core, test_vector_push_back );
+  tcase_add_test( tc_core, test_vector_pop_back );
+  tcase_add_test( tc_core, test_vector_reserve );
+  tcase_add_test( tc_core, test_vector_cleanup );
+  tcase_add_test( tc_core, test_vector_construct_arena );
+  tcase_add_test( tc_core, test_vector_define );
+  suite_add_tcase( s, tc_core );
+  // return suite
+  return s;
+}
+
+int main( void ) {
+  int number_failed;
+  Suite* s;
+  SRunner* sr;
+
+  s = vector_suite();
+  sr = srunner_create( s );
+
+  srunner_run_all( sr, CK_NORMAL );
+  number_failed = srunner_ntests_failed( sr );
+  srunner_free( sr );
+  return ( 0 == number_failed ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}